@@ -32,6 +32,10 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/zip_io.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 #include "thirdparty/misc/fastlz.h"
 
@@ -47,7 +51,75 @@ static ZSTD_DCtx *current_zstd_d_ctx = nullptr;
 static bool current_zstd_long_distance_matching;
 static int current_zstd_window_log_size;
 
-int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
+// Registered zstd dictionaries. Compression tables are built lazily, the ones for
+// compression depend on the compression level. Once built they're read-only, so they
+// are only guarded by the mutex while being looked up or created, and a reference is
+// held while they're in use so unregistering can't free them mid-operation.
+struct ZstdDictionary {
+	Vector<uint8_t> data;
+	HashMap<int, ZSTD_CDict *> cdicts;
+	ZSTD_DDict *ddict = nullptr;
+	SafeRefCount refcount;
+
+	ZstdDictionary() {
+		refcount.init();
+	}
+
+	~ZstdDictionary() {
+		for (KeyValue<int, ZSTD_CDict *> &E : cdicts) {
+			ZSTD_freeCDict(E.value);
+		}
+		if (ddict) {
+			ZSTD_freeDDict(ddict);
+		}
+	}
+};
+
+static BinaryMutex zstd_dictionaries_mutex;
+static HashMap<uint32_t, ZstdDictionary *> zstd_dictionaries;
+
+static void _zstd_dictionary_unref(ZstdDictionary *p_dictionary) {
+	if (p_dictionary->refcount.unref()) {
+		memdelete(p_dictionary);
+	}
+}
+
+static ZstdDictionary *_zstd_dictionary_ref_for_compression(uint32_t p_id, int p_level, const ZSTD_CDict **r_cdict) {
+	MutexLock lock(zstd_dictionaries_mutex);
+	ZstdDictionary **dictionary = zstd_dictionaries.getptr(p_id);
+	if (!dictionary) {
+		return nullptr;
+	}
+
+	ZstdDictionary *d = *dictionary;
+	ZSTD_CDict **cdict = d->cdicts.getptr(p_level);
+	if (!cdict) {
+		cdict = &d->cdicts.insert(p_level, ZSTD_createCDict(d->data.ptr(), d->data.size(), p_level))->value;
+	}
+	*r_cdict = *cdict;
+	d->refcount.ref();
+	return d;
+}
+
+static ZstdDictionary *_zstd_dictionary_ref_for_decompression(uint32_t p_id, const ZSTD_DDict **r_ddict) {
+	MutexLock lock(zstd_dictionaries_mutex);
+	ZstdDictionary **dictionary = zstd_dictionaries.getptr(p_id);
+	if (!dictionary) {
+		return nullptr;
+	}
+
+	ZstdDictionary *d = *dictionary;
+	if (!d->ddict) {
+		d->ddict = ZSTD_createDDict(d->data.ptr(), d->data.size());
+	}
+	*r_ddict = d->ddict;
+	d->refcount.ref();
+	return d;
+}
+
+int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode, uint32_t p_zstd_dictionary_id) {
+	ERR_FAIL_COND_V_MSG(p_zstd_dictionary_id != 0 && p_mode != MODE_ZSTD, -1, "Dictionaries are only supported by Zstd compression.");
+
 	switch (p_mode) {
 		case MODE_BROTLI: {
 			ERR_FAIL_V_MSG(-1, "Only brotli decompression is supported.");
@@ -98,6 +170,26 @@ int64_t Compression::compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_sr
 				ZSTD_CCtx_setParameter(cctx, ZSTD_c_windowLog, zstd_window_log_size);
 			}
 			const int64_t max_dst_size = get_max_compressed_buffer_size(p_src_size, MODE_ZSTD);
+
+			if (p_zstd_dictionary_id != 0) {
+				const ZSTD_CDict *cdict = nullptr;
+				ZstdDictionary *d = _zstd_dictionary_ref_for_compression(p_zstd_dictionary_id, zstd_level, &cdict);
+				if (!d) {
+					ZSTD_freeCCtx(cctx);
+					ERR_FAIL_V_MSG(-1, vformat("Zstd dictionary %d is not registered.", p_zstd_dictionary_id));
+				}
+
+				// Raw content dictionaries are only told apart by a 24-bit hash, so store a checksum
+				// of the content to make decompressing with the wrong dictionary fail instead of
+				// returning garbage.
+				ZSTD_CCtx_setParameter(cctx, ZSTD_c_checksumFlag, 1);
+				ZSTD_CCtx_refCDict(cctx, cdict);
+				const size_t ret = ZSTD_compress2(cctx, p_dst, max_dst_size, p_src, p_src_size);
+				ZSTD_freeCCtx(cctx);
+				_zstd_dictionary_unref(d);
+				return ZSTD_isError(ret) ? -1 : (int64_t)ret;
+			}
+
 			const size_t ret = ZSTD_compressCCtx(cctx, p_dst, max_dst_size, p_src, p_src_size, zstd_level);
 			ZSTD_freeCCtx(cctx);
 			return (int64_t)ret;
@@ -146,7 +238,9 @@ int64_t Compression::get_max_compressed_buffer_size(int64_t p_src_size, Mode p_m
 	ERR_FAIL_V(-1);
 }
 
-int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode) {
+int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode, uint32_t p_zstd_dictionary_id) {
+	ERR_FAIL_COND_V_MSG(p_zstd_dictionary_id != 0 && p_mode != MODE_ZSTD, -1, "Dictionaries are only supported by Zstd compression.");
+
 	switch (p_mode) {
 		case MODE_BROTLI: {
 #ifdef BROTLI_ENABLED
@@ -213,6 +307,16 @@ int64_t Compression::decompress(uint8_t *p_dst, int64_t p_dst_max_size, const ui
 				current_zstd_window_log_size = zstd_window_log_size;
 			}
 
+			if (p_zstd_dictionary_id != 0) {
+				const ZSTD_DDict *ddict = nullptr;
+				ZstdDictionary *d = _zstd_dictionary_ref_for_decompression(p_zstd_dictionary_id, &ddict);
+				ERR_FAIL_NULL_V_MSG(d, -1, vformat("Zstd dictionary %d is not registered.", p_zstd_dictionary_id));
+
+				const size_t ret = ZSTD_decompress_usingDDict(current_zstd_d_ctx, p_dst, p_dst_max_size, p_src, p_src_size, ddict);
+				_zstd_dictionary_unref(d);
+				return ZSTD_isError(ret) ? -1 : (int64_t)ret;
+			}
+
 			size_t ret = ZSTD_decompressDCtx(current_zstd_d_ctx, p_dst, p_dst_max_size, p_src, p_src_size);
 			return (int64_t)ret;
 		} break;
@@ -369,3 +473,169 @@ int Compression::decompress_dynamic(Vector<uint8_t> *p_dst_vect, int64_t p_max_d
 		return Z_OK;
 	}
 }
+
+// Simplified version of zstd's FastCover trainer (zstd's dictBuilder isn't bundled).
+// The dictionary is made of the segments of the samples that contain the most frequent
+// d-mers, which is what lets the first occurrence of a common pattern in a small input
+// become a match. The result is a raw content dictionary: it holds no entropy tables.
+Vector<uint8_t> Compression::train_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int p_max_size) {
+	ERR_FAIL_COND_V_MSG(p_max_size < 256, Vector<uint8_t>(), "Zstd dictionaries must be at least 256 bytes.");
+
+	constexpr int DMER_SIZE = 8;
+	constexpr int SEGMENT_SIZE = 1024;
+	constexpr int HASH_LOG = 20;
+	constexpr uint32_t INVALID_DMER = UINT32_MAX;
+
+	// Concatenate the samples, d-mers that would cross a sample boundary are ignored.
+	LocalVector<uint8_t> corpus;
+	LocalVector<uint32_t> dmers;
+	for (const Vector<uint8_t> &sample : p_samples) {
+		const uint32_t from = corpus.size();
+		corpus.resize(from + sample.size());
+		memcpy(corpus.ptr() + from, sample.ptr(), sample.size());
+
+		dmers.resize(corpus.size());
+		for (int i = 0; i < sample.size(); i++) {
+			if (i + DMER_SIZE > sample.size()) {
+				dmers[from + i] = INVALID_DMER;
+				continue;
+			}
+			uint64_t dmer;
+			memcpy(&dmer, sample.ptr() + i, DMER_SIZE);
+			dmers[from + i] = uint32_t((dmer * 0xCF1BBCDCB7A56463ULL) >> (64 - HASH_LOG));
+		}
+	}
+	ERR_FAIL_COND_V_MSG(corpus.size() < (uint32_t)DMER_SIZE, Vector<uint8_t>(), "Not enough sample data to train a Zstd dictionary.");
+
+	LocalVector<uint32_t> frequencies;
+	frequencies.resize_initialized(1 << HASH_LOG);
+	for (const uint32_t dmer : dmers) {
+		if (dmer != INVALID_DMER) {
+			frequencies[dmer]++;
+		}
+	}
+
+	const uint32_t segment_size = MIN(uint32_t(SEGMENT_SIZE), corpus.size());
+	const uint32_t max_size = MIN(uint32_t(p_max_size), corpus.size());
+
+	// Split the corpus in epochs and pick the best segment of each one, so the dictionary
+	// covers all of the samples and not only their most repetitive part.
+	const uint32_t epoch_count = MAX(1u, MIN(max_size / segment_size, corpus.size() / (segment_size * 4)));
+	const uint32_t epoch_size = corpus.size() / epoch_count;
+
+	// Number of occurrences of each d-mer in the current window, so repeated d-mers are only counted once.
+	LocalVector<uint16_t> window_counts;
+	window_counts.resize_initialized(1 << HASH_LOG);
+
+	Vector<uint8_t> dictionary;
+	dictionary.resize(max_size);
+	uint8_t *w = dictionary.ptrw();
+	uint32_t tail = max_size;
+	uint32_t fruitless_epochs = 0;
+
+	for (uint32_t epoch = 0; tail > 0 && fruitless_epochs < epoch_count; epoch = (epoch + 1) % epoch_count) {
+		const uint32_t begin = epoch * epoch_size;
+		const uint32_t end = epoch == epoch_count - 1 ? corpus.size() : begin + epoch_size;
+		const uint32_t window = MIN(segment_size, end - begin);
+
+		uint64_t score = 0;
+		uint64_t best_score = 0;
+		uint32_t best_begin = begin;
+		for (uint32_t i = begin; i < end; i++) {
+			const uint32_t added = dmers[i];
+			if (added != INVALID_DMER && window_counts[added]++ == 0) {
+				score += frequencies[added];
+			}
+			if (i >= begin + window) {
+				const uint32_t removed = dmers[i - window];
+				if (removed != INVALID_DMER && --window_counts[removed] == 0) {
+					score -= frequencies[removed];
+				}
+			}
+			if (i + 1 >= begin + window && score > best_score) {
+				best_score = score;
+				best_begin = i + 1 - window;
+			}
+		}
+		for (uint32_t i = MAX(begin, end - MIN(window, end - begin)); i < end; i++) {
+			if (dmers[i] != INVALID_DMER) {
+				window_counts[dmers[i]] = 0;
+			}
+		}
+
+		if (best_score == 0) {
+			fruitless_epochs++;
+			continue;
+		}
+		fruitless_epochs = 0;
+
+		// Already selected d-mers don't add anything to later segments.
+		for (uint32_t i = best_begin; i < best_begin + window; i++) {
+			if (dmers[i] != INVALID_DMER) {
+				frequencies[dmers[i]] = 0;
+			}
+		}
+
+		// Zstd gives shorter offsets to the end of the dictionary, fill it backwards
+		// so the segments picked first (the most useful ones) end up there.
+		const uint32_t copy_size = MIN(window, tail);
+		tail -= copy_size;
+		memcpy(w + tail, corpus.ptr() + best_begin, copy_size);
+	}
+
+	if (tail > 0) {
+		memmove(w, w + tail, max_size - tail);
+		dictionary.resize(max_size - tail);
+	}
+
+	return dictionary;
+}
+
+uint32_t Compression::get_zstd_dictionary_id(const Vector<uint8_t> &p_dictionary) {
+	// Dictionaries in the zstd format carry their own ID, raw content ones are identified by their hash.
+	uint32_t id = ZSTD_getDictID_fromDict(p_dictionary.ptr(), p_dictionary.size());
+	if (id == 0) {
+		id = hash_murmur3_buffer(p_dictionary.ptr(), p_dictionary.size());
+	}
+	id &= ZSTD_DICTIONARY_ID_MAX;
+	return id == 0 ? 1 : id;
+}
+
+Error Compression::register_zstd_dictionary(uint32_t p_id, const Vector<uint8_t> &p_dictionary) {
+	ERR_FAIL_COND_V_MSG(p_id == 0 || p_id > ZSTD_DICTIONARY_ID_MAX, ERR_INVALID_PARAMETER, vformat("Invalid Zstd dictionary ID: %d.", p_id));
+	ERR_FAIL_COND_V_MSG(p_dictionary.size() < 8, ERR_INVALID_PARAMETER, "Zstd dictionaries must be at least 8 bytes.");
+
+	MutexLock lock(zstd_dictionaries_mutex);
+	ZstdDictionary **existing = zstd_dictionaries.getptr(p_id);
+	if (existing) {
+		// Registering the same dictionary again, e.g. when a pack is loaded twice, is fine.
+		ERR_FAIL_COND_V_MSG((*existing)->data != p_dictionary, ERR_ALREADY_EXISTS, vformat("A different Zstd dictionary is already registered with ID %d.", p_id));
+		return OK;
+	}
+
+	ZstdDictionary *d = memnew(ZstdDictionary);
+	d->data = p_dictionary;
+	zstd_dictionaries.insert(p_id, d);
+	return OK;
+}
+
+void Compression::unregister_zstd_dictionary(uint32_t p_id) {
+	MutexLock lock(zstd_dictionaries_mutex);
+	ZstdDictionary **dictionary = zstd_dictionaries.getptr(p_id);
+	ERR_FAIL_NULL_MSG(dictionary, vformat("Zstd dictionary %d is not registered.", p_id));
+	_zstd_dictionary_unref(*dictionary);
+	zstd_dictionaries.erase(p_id);
+}
+
+bool Compression::has_zstd_dictionary(uint32_t p_id) {
+	MutexLock lock(zstd_dictionaries_mutex);
+	return zstd_dictionaries.has(p_id);
+}
+
+void Compression::clear_zstd_dictionaries() {
+	MutexLock lock(zstd_dictionaries_mutex);
+	for (KeyValue<uint32_t, ZstdDictionary *> &E : zstd_dictionaries) {
+		_zstd_dictionary_unref(E.value);
+	}
+	zstd_dictionaries.clear();
+}
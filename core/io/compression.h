@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/error/error_list.h"
 #include "core/templates/vector.h"
 #include "core/typedefs.h"
 
@@ -44,6 +45,11 @@ public:
 	static inline int zstd_window_log_size = 27; // ZSTD_WINDOWLOG_LIMIT_DEFAULT
 	static inline int gzip_chunk = 16384;
 
+	// Same default as `zstd --train`.
+	static constexpr int ZSTD_DICTIONARY_DEFAULT_MAX_SIZE = 112640;
+	// IDs are stored in 24 bits by FileAccessCompressed, 0 means no dictionary.
+	static constexpr uint32_t ZSTD_DICTIONARY_ID_MAX = 0xFFFFFF;
+
 	enum Mode : int32_t {
 		MODE_FASTLZ,
 		MODE_DEFLATE,
@@ -52,8 +58,17 @@ public:
 		MODE_BROTLI
 	};
 
-	static int64_t compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD);
+	static int64_t compress(uint8_t *p_dst, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD, uint32_t p_zstd_dictionary_id = 0);
 	static int64_t get_max_compressed_buffer_size(int64_t p_src_size, Mode p_mode = MODE_ZSTD);
-	static int64_t decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD);
+	static int64_t decompress(uint8_t *p_dst, int64_t p_dst_max_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode = MODE_ZSTD, uint32_t p_zstd_dictionary_id = 0);
 	static int decompress_dynamic(Vector<uint8_t> *p_dst_vect, int64_t p_max_dst_size, const uint8_t *p_src, int64_t p_src_size, Mode p_mode);
+
+	// Shared dictionaries make zstd efficient on small inputs (resource files, network packets)
+	// that are too short to build up a useful history on their own.
+	static Vector<uint8_t> train_zstd_dictionary(const Vector<Vector<uint8_t>> &p_samples, int p_max_size = ZSTD_DICTIONARY_DEFAULT_MAX_SIZE);
+	static uint32_t get_zstd_dictionary_id(const Vector<uint8_t> &p_dictionary);
+	static Error register_zstd_dictionary(uint32_t p_id, const Vector<uint8_t> &p_dictionary);
+	static void unregister_zstd_dictionary(uint32_t p_id);
+	static bool has_zstd_dictionary(uint32_t p_id);
+	static void clear_zstd_dictionaries();
 };
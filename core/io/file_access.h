@@ -191,6 +191,7 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const { return Span<uint8_t>(); } ///< get a read-only view of the next bytes without copying and advance the position, empty if unsupported (fall back to get_buffer()); valid until the file is closed
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
@@ -234,6 +235,8 @@ public:
 
 	virtual void close() = 0;
 
+	virtual const uint8_t *map_read_only(uint64_t &r_size) { return nullptr; } ///< map the whole file read-only into memory, nullptr if unsupported; unmapped when the file is closed
+
 	virtual bool file_exists(const String &p_name) = 0; ///< return true if a file exists
 
 	virtual Error reopen(const String &p_path, int p_mode_flags); ///< does not change the AccessType
@@ -30,17 +30,28 @@
 
 #include "file_access_compressed.h"
 
-void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size, uint32_t p_zstd_dictionary_id) {
 	magic = p_magic.ascii().get_data();
 	magic = (magic + "    ").substr(0, 4);
 
+	ERR_FAIL_COND_MSG(p_zstd_dictionary_id != 0 && p_mode != Compression::MODE_ZSTD, "Dictionaries are only supported by Zstd compression.");
+	ERR_FAIL_COND_MSG(p_zstd_dictionary_id > Compression::ZSTD_DICTIONARY_ID_MAX, vformat("Invalid Zstd dictionary ID: %d.", p_zstd_dictionary_id));
+
 	cmode = p_mode;
 	block_size = p_block_size;
+	zstd_dictionary_id = p_zstd_dictionary_id;
 }
 
 Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	f = p_base;
-	cmode = (Compression::Mode)f->get_32();
+	// The dictionary ID is stored in the upper 24 bits of the mode, files without one read the same as before.
+	const uint32_t mode = f->get_32();
+	cmode = (Compression::Mode)(mode & 0xFF);
+	zstd_dictionary_id = mode >> 8;
+	if (zstd_dictionary_id != 0 && !Compression::has_zstd_dictionary(zstd_dictionary_id)) {
+		f.unref();
+		ERR_FAIL_V_MSG(ERR_FILE_UNRECOGNIZED, vformat("Can't open compressed file '%s', it requires Zstd dictionary %d which is not registered.", p_base->get_path(), zstd_dictionary_id));
+	}
 	block_size = f->get_32();
 	if (block_size == 0) {
 		f.unref();
@@ -68,7 +79,7 @@ Error FileAccessCompressed::open_after_magic(Ref<FileAccess> p_base) {
 	read_block_count = bc;
 	read_block_size = read_blocks.size() == 1 ? read_total : block_size;
 
-	const int64_t ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode);
+	const int64_t ret = Compression::decompress(buffer.ptrw(), read_block_size, comp_buffer.ptr(), read_blocks[0].csize, cmode, zstd_dictionary_id);
 	read_block = 0;
 	read_pos = 0;
 
@@ -121,7 +132,7 @@ void FileAccessCompressed::_close() {
 
 		CharString mgc = magic.utf8();
 		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
+		f->store_32(cmode | (zstd_dictionary_id << 8)); //write compression mode and dictionary 4
 		f->store_32(block_size); //write block size 4
 		f->store_32(uint32_t(write_max)); //max amount of data written 4
 		uint32_t bc = (write_max / block_size) + 1;
@@ -143,7 +154,7 @@ void FileAccessCompressed::_close() {
 			uint32_t bl = i == (bc - 1) ? last_block_size : block_size;
 			uint8_t *bp = &write_ptr[i * block_size];
 
-			const int64_t compressed_size = Compression::compress(temp_cblock_ptr, bp, bl, cmode);
+			const int64_t compressed_size = Compression::compress(temp_cblock_ptr, bp, bl, cmode, zstd_dictionary_id);
 			ERR_FAIL_COND_MSG(compressed_size < 0, "FileAccessCompressed: Error compressing data.");
 
 			f->store_buffer(temp_cblock_ptr, (uint64_t)compressed_size);
@@ -204,7 +215,7 @@ void FileAccessCompressed::seek(uint64_t p_position) {
 				read_block = block_idx;
 				f->seek(read_blocks[read_block].offset);
 				f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-				const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
+				const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode, zstd_dictionary_id);
 				ERR_FAIL_COND_MSG(ret == -1, "Compressed file is corrupt.");
 				read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
 			}
@@ -292,7 +303,7 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 
 		// Read the next block of compressed data.
 		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
-		const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
+		const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode, zstd_dictionary_id);
 		ERR_FAIL_COND_V_MSG(ret == -1, -1, "Compressed file is corrupt.");
 		read_block_size = read_block == read_block_count - 1 ? read_total % block_size : block_size;
 		read_pos = 0;
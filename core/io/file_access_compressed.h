@@ -36,6 +36,7 @@
 class FileAccessCompressed : public FileAccess {
 	GDSOFTCLASS(FileAccessCompressed, FileAccess);
 	Compression::Mode cmode = Compression::MODE_ZSTD;
+	uint32_t zstd_dictionary_id = 0;
 	bool writing = false;
 	uint64_t write_pos = 0;
 	uint8_t *write_ptr = nullptr;
@@ -66,7 +67,7 @@ class FileAccessCompressed : public FileAccess {
 	void _close();
 
 public:
-	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+	void configure(const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096, uint32_t p_zstd_dictionary_id = 0);
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
@@ -30,10 +30,13 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_patched.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
 #include "core/version.h"
 
 Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
@@ -46,7 +49,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta, bool p_compressed) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -56,6 +59,7 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	pf.encrypted = p_encrypted;
 	pf.bundle = p_bundle;
 	pf.delta = p_delta;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -191,7 +195,12 @@ PackedData::PackedData() {
 	singleton = this;
 	root = memnew(PackedDir);
 
-	add_pack_source(memnew(PackedSourcePCK));
+	if constexpr (sizeof(void *) >= 8) {
+		// Mapping large packs needs a 64-bit address space.
+		add_pack_source(memnew(PackedSourcePCKMapped));
+	} else {
+		add_pack_source(memnew(PackedSourcePCK));
+	}
 }
 
 void PackedData::_free_packed_dirs(PackedDir *p_dir) {
@@ -333,6 +342,18 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f = fae;
 	}
 
+	// Files are only added once the dictionaries they may need are registered, so a pack
+	// that can't be decompressed isn't partially loaded.
+	struct DirectoryEntry {
+		String path;
+		uint64_t ofs = 0;
+		uint64_t size = 0;
+		uint8_t md5[16] = {};
+		uint32_t flags = 0;
+	};
+	LocalVector<DirectoryEntry> entries;
+	LocalVector<Pair<uint32_t, PackedData::PackedFile>> zstd_dictionaries;
+
 	for (int i = 0; i < file_count; i++) {
 		uint32_t sl = f->get_32();
 		CharString cs;
@@ -347,28 +368,116 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		f->get_buffer(md5, 16);
 		uint32_t flags = f->get_32();
 
-		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
-			PackedData::get_singleton()->remove_path(path);
+		DirectoryEntry entry;
+		entry.path = path;
+		entry.ofs = ofs;
+		entry.size = size;
+		memcpy(entry.md5, md5, 16);
+		entry.flags = flags;
+		entries.push_back(entry);
+
+		if (!(flags & PACK_FILE_REMOVAL) && !sparse_bundle && path.trim_prefix("res://").begins_with(PACK_ZSTD_DICTIONARY_DIR)) {
+			PackedData::PackedFile pf;
+			pf.pack = p_path;
+			pf.offset = file_base + ofs;
+			pf.size = size;
+			pf.src = this;
+			pf.encrypted = (flags & PACK_FILE_ENCRYPTED);
+			pf.bundle = false;
+			pf.delta = false;
+			pf.compressed = false;
+			memcpy(pf.md5, md5, 16);
+			zstd_dictionaries.push_back(Pair<uint32_t, PackedData::PackedFile>(path.get_file().get_basename().to_int(), pf));
+		}
+	}
+
+	// Register the dictionaries of compressed entries, before anything can be read from the pack.
+	LocalVector<uint32_t> registered_dictionaries;
+	for (const Pair<uint32_t, PackedData::PackedFile> &E : zstd_dictionaries) {
+		Ref<FileAccess> df = memnew(FileAccessPack(p_path, E.second));
+		Vector<uint8_t> dictionary;
+		dictionary.resize(E.second.size);
+		df->get_buffer(dictionary.ptrw(), E.second.size);
+
+		const bool already_registered = Compression::has_zstd_dictionary(E.first);
+		Error err = ERR_FILE_CORRUPT;
+		if (Compression::get_zstd_dictionary_id(dictionary) == E.first) {
+			err = Compression::register_zstd_dictionary(E.first, dictionary);
+		}
+		if (err != OK) {
+			for (uint32_t id : registered_dictionaries) {
+				Compression::unregister_zstd_dictionary(id);
+			}
+			ERR_FAIL_V_MSG(false, vformat("Can't register Zstd dictionary %d of pack \"%s\": %s.", E.first, p_path, error_names[err]));
+		}
+		if (!already_registered) {
+			registered_dictionaries.push_back(E.first);
+		}
+	}
+
+	for (const DirectoryEntry &entry : entries) {
+		if (entry.flags & PACK_FILE_REMOVAL) { // The file was removed.
+			PackedData::get_singleton()->remove_path(entry.path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle, (flags & PACK_FILE_DELTA));
+			PackedData::get_singleton()->add_path(p_path, entry.path, file_base + entry.ofs, entry.size, entry.md5, this, p_replace_files, (entry.flags & PACK_FILE_ENCRYPTED), sparse_bundle, (entry.flags & PACK_FILE_DELTA), (entry.flags & PACK_FILE_COMPRESSED));
 		}
 	}
 
 	return true;
 }
 
+Ref<FileAccess> PackedSourcePCK::_apply_delta_patches(const String &p_path, const Ref<FileAccess> &p_file) const {
+	if (!PackedData::get_singleton()->has_delta_patches(p_path)) {
+		return p_file;
+	}
+
+	Ref<FileAccessPatched> file_patched;
+	file_patched.instantiate();
+	Error err = file_patched->open_custom(p_file);
+	ERR_FAIL_COND_V(err != OK, Ref<FileAccess>());
+	return file_patched;
+}
+
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file) {
-	Ref<FileAccess> file(memnew(FileAccessPack(p_path, *p_file)));
+	return _apply_delta_patches(p_path, memnew(FileAccessPack(p_path, *p_file)));
+}
+
+//////////////////////////////////////////////////////////////////
+
+bool PackedSourcePCKMapped::try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
+	if (!PackedSourcePCK::try_open_pack(p_path, p_replace_files, p_offset)) {
+		return false;
+	}
+
+	if (mappings.has(p_path)) {
+		return true;
+	}
 
-	if (PackedData::get_singleton()->has_delta_patches(p_path)) {
-		Ref<FileAccessPatched> file_patched;
-		file_patched.instantiate();
-		Error err = file_patched->open_custom(file);
-		ERR_FAIL_COND_V(err != OK, Ref<FileAccess>());
-		file = file_patched;
+	Mapping mapping;
+	mapping.file = FileAccess::open(p_path, FileAccess::READ);
+	if (mapping.file.is_valid()) {
+		mapping.data = mapping.file->map_read_only(mapping.size);
+	}
+	if (mapping.data) {
+		mappings.insert(p_path, mapping);
+	} else {
+		print_verbose(vformat("Can't memory map pack \"%s\", falling back to buffered reads.", p_path));
 	}
 
-	return file;
+	return true;
+}
+
+Ref<FileAccess> PackedSourcePCKMapped::get_file(const String &p_path, PackedData::PackedFile *p_file) {
+	if (p_file->encrypted || p_file->compressed || p_file->bundle) {
+		return PackedSourcePCK::get_file(p_path, p_file);
+	}
+
+	HashMap<String, Mapping>::ConstIterator E = mappings.find(p_file->pack);
+	if (!E || p_file->offset + p_file->size > E->value.size) {
+		return PackedSourcePCK::get_file(p_path, p_file);
+	}
+
+	return _apply_delta_patches(p_path, memnew(FileAccessPack(p_path, *p_file, E->value.file, E->value.data)));
 }
 
 //////////////////////////////////////////////////////////////////
@@ -417,7 +526,9 @@ Error FileAccessPack::open_internal(const String &p_path, int p_mode_flags) {
 }
 
 bool FileAccessPack::is_open() const {
-	if (f.is_valid()) {
+	if (mapped_data) {
+		return true;
+	} else if (f.is_valid()) {
 		return f->is_open();
 	} else {
 		return false;
@@ -425,7 +536,7 @@ bool FileAccessPack::is_open() const {
 }
 
 void FileAccessPack::seek(uint64_t p_position) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	if (p_position > pf.size) {
 		eof = true;
@@ -433,7 +544,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (f.is_valid()) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -454,7 +567,7 @@ bool FileAccessPack::eof_reached() const {
 }
 
 uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
-	ERR_FAIL_COND_V_MSG(f.is_null(), -1, "File must be opened before use.");
+	ERR_FAIL_COND_V_MSG(f.is_null() && !mapped_data, -1, "File must be opened before use.");
 	ERR_FAIL_COND_V(!p_dst && p_length > 0, -1);
 
 	if (eof) {
@@ -467,21 +580,46 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
+	const uint64_t read_pos = pos;
 	pos += to_read;
 
 	if (to_read <= 0) {
 		return 0;
 	}
-	f->get_buffer(p_dst, to_read);
+
+	if (mapped_data) {
+		memcpy(p_dst, mapped_data + off + read_pos, to_read);
+	} else {
+		f->get_buffer(p_dst, to_read);
+	}
 
 	return to_read;
 }
 
+Span<uint8_t> FileAccessPack::get_buffer_view(uint64_t p_length) const {
+	if (!mapped_data || eof) {
+		return Span<uint8_t>();
+	}
+
+	uint64_t to_read = p_length;
+	if (to_read + pos > pf.size) {
+		eof = true;
+		to_read = pf.size - pos;
+	}
+
+	Span<uint8_t> view(mapped_data + off + pos, to_read);
+	pos += to_read;
+
+	return view;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
-	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
+	ERR_FAIL_COND_MSG(f.is_null() && !mapped_data, "File must be opened before use.");
 
 	FileAccess::set_big_endian(p_big_endian);
-	f->set_big_endian(p_big_endian);
+	if (f.is_valid()) {
+		f->set_big_endian(p_big_endian);
+	}
 }
 
 Error FileAccessPack::get_error() const {
@@ -505,6 +643,8 @@ bool FileAccessPack::file_exists(const String &p_name) {
 
 void FileAccessPack::close() {
 	f = Ref<FileAccess>();
+	mapped_file = Ref<FileAccess>();
+	mapped_data = nullptr;
 }
 
 FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file) {
@@ -538,6 +678,34 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		// Compressed entries are stored as a FileAccessCompressed stream, so seeking
+		// only decompresses the block that contains the new position.
+		uint8_t magic[4] = { 0, 0, 0, 0 };
+		f->get_buffer(magic, 4);
+		ERR_FAIL_COND_MSG(memcmp(magic, PACK_FILE_COMPRESSED_MAGIC, 4) != 0, vformat(R"(Can't open compressed pack-referenced file "%s" from pack "%s", it is corrupted.)", p_path, pf.pack));
+
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		Error err = fac->open_after_magic(f);
+		if (err != OK) {
+			f = Ref<FileAccess>();
+			ERR_FAIL_MSG(vformat(R"(Can't open compressed pack-referenced file "%s" from pack "%s".)", p_path, pf.pack));
+		}
+		f = fac;
+		off = 0;
+	}
+	pos = 0;
+	eof = false;
+}
+
+FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_file, const uint8_t *p_mapped_data) {
+	path = p_path;
+	pf = p_file;
+	mapped_file = p_mapped_file;
+	mapped_data = p_mapped_data;
+	off = pf.offset;
 	pos = 0;
 	eof = false;
 }
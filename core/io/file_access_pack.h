@@ -55,8 +55,16 @@ enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
 	PACK_FILE_DELTA = 1 << 2,
+	PACK_FILE_COMPRESSED = 1 << 3,
 };
 
+// Magic of compressed pack entries, which are stored in the FileAccessCompressed block format ("GCPF" in ASCII).
+#define PACK_FILE_COMPRESSED_MAGIC "GCPF"
+
+// Zstd dictionaries used by compressed entries are stored uncompressed in this directory,
+// as "<id>.zdict", and are registered when the pack is opened.
+#define PACK_ZSTD_DICTIONARY_DIR ".godot/zstd_dictionaries/"
+
 class PackSource;
 
 class PackedData {
@@ -74,6 +82,7 @@ public:
 		bool encrypted;
 		bool bundle;
 		bool delta;
+		bool compressed;
 	};
 
 private:
@@ -119,7 +128,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_delta = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_delta = false, bool p_compressed = false); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
 	Vector<PackedFile> get_delta_patches(const String &p_path) const;
@@ -154,6 +163,27 @@ public:
 };
 
 class PackedSourcePCK : public PackSource {
+protected:
+	Ref<FileAccess> _apply_delta_patches(const String &p_path, const Ref<FileAccess> &p_file) const;
+
+public:
+	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
+	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
+};
+
+// Serves plain (non-encrypted, non-compressed, non-sparse) files from a read-only memory mapping of the pack,
+// so reads are copies from the page cache instead of seek/read syscalls, and readers can
+// request zero-copy views with FileAccess::get_buffer_view(). Falls back to PackedSourcePCK
+// when the pack can't be mapped.
+class PackedSourcePCKMapped : public PackedSourcePCK {
+	struct Mapping {
+		Ref<FileAccess> file;
+		const uint8_t *data = nullptr;
+		uint64_t size = 0;
+	};
+
+	HashMap<String, Mapping> mappings;
+
 public:
 	virtual bool try_open_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) override;
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
@@ -177,6 +207,11 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// Set when reading from a mapped pack, `f` is null in that case.
+	Ref<FileAccess> mapped_file;
+	const uint8_t *mapped_data = nullptr;
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -203,6 +238,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_buffer_view(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -217,6 +253,7 @@ public:
 	virtual void close() override;
 
 	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file, const Ref<FileAccess> &p_mapped_file, const uint8_t *p_mapped_data);
 };
 
 int64_t PackedData::get_size(const String &p_path) {
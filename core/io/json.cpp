@@ -33,7 +33,9 @@
 #include "core/config/engine.h"
 #include "core/io/file_access.h"
 #include "core/object/script_language.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/container_type_validate.h"
+#include "core/variant/variant_internal.h"
 
 const char *JSON::tk_name[TK_MAX] = {
 	"'{'",
@@ -48,13 +50,728 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-void JSON::_add_indent(String &r_result, const String &p_indent, int p_size) {
+// Output of stringify_to_utf8_buffer(). Writes UTF-8 straight into a buffer that grows
+// geometrically, instead of building an intermediate UTF-32 String.
+class JSONUTF8Writer {
+	Vector<uint8_t> buffer;
+	uint8_t *w = nullptr;
+	int64_t size = 0;
+	int64_t capacity = 0;
+
+	void _grow(int64_t p_needed) {
+		capacity = MAX(capacity * 2, size + p_needed);
+		buffer.resize(capacity);
+		w = buffer.ptrw();
+	}
+
+	_FORCE_INLINE_ void _append_char(char32_t p_char) {
+		if (size + 4 > capacity) {
+			_grow(4);
+		}
+		if (p_char <= 0x7f) {
+			w[size++] = p_char;
+		} else if (p_char <= 0x7ff) {
+			w[size++] = 0xc0 | (p_char >> 6);
+			w[size++] = 0x80 | (p_char & 0x3f);
+		} else if (p_char <= 0xffff) {
+			w[size++] = 0xe0 | (p_char >> 12);
+			w[size++] = 0x80 | ((p_char >> 6) & 0x3f);
+			w[size++] = 0x80 | (p_char & 0x3f);
+		} else if (p_char <= 0x10ffff) {
+			w[size++] = 0xf0 | (p_char >> 18);
+			w[size++] = 0x80 | ((p_char >> 12) & 0x3f);
+			w[size++] = 0x80 | ((p_char >> 6) & 0x3f);
+			w[size++] = 0x80 | (p_char & 0x3f);
+		} else {
+			_append_char(0xfffd); // Not representable as UTF-8.
+		}
+	}
+
+public:
+	JSONUTF8Writer() {
+		_grow(4096);
+	}
+
+	void operator+=(char p_char) {
+		_append_char(p_char);
+	}
+
+	void operator+=(const char *p_str) {
+		const int64_t len = strlen(p_str);
+		if (size + len > capacity) {
+			_grow(len);
+		}
+		memcpy(w + size, p_str, len);
+		size += len;
+	}
+
+	void operator+=(const String &p_str) {
+		const char32_t *src = p_str.ptr();
+		for (int i = 0; i < p_str.length(); i++) {
+			_append_char(src[i]);
+		}
+	}
+
+	// Same escaping as String::json_escape().
+	void append_escaped(const String &p_str) {
+		const char32_t *src = p_str.ptr();
+		for (int i = 0; i < p_str.length(); i++) {
+			const char32_t c = src[i];
+			switch (c) {
+				case '\\':
+					*this += "\\\\";
+					break;
+				case '\b':
+					*this += "\\b";
+					break;
+				case '\f':
+					*this += "\\f";
+					break;
+				case '\n':
+					*this += "\\n";
+					break;
+				case '\r':
+					*this += "\\r";
+					break;
+				case '\t':
+					*this += "\\t";
+					break;
+				case '\v':
+					*this += "\\v";
+					break;
+				case '"':
+					*this += "\\\"";
+					break;
+				default:
+					_append_char(c);
+			}
+		}
+	}
+
+	Vector<uint8_t> finish() {
+		buffer.resize(size);
+		w = nullptr;
+		capacity = size;
+		return buffer;
+	}
+};
+
+static _FORCE_INLINE_ void _append_json_escaped(String &r_result, const String &p_str) {
+	r_result += p_str.json_escape();
+}
+
+static _FORCE_INLINE_ void _append_json_escaped(JSONUTF8Writer &r_result, const String &p_str) {
+	r_result.append_escaped(p_str);
+}
+
+// Builds the Variant tree for JSON::parse_utf8_buffer(), using the same events
+// as JSON::EventHandler without virtual calls.
+class JSONVariantBuilder {
+	struct Container {
+		Variant value;
+		String key;
+	};
+	LocalVector<Container> stack;
+
+	bool _add(const Variant &p_value) {
+		if (stack.is_empty()) {
+			result = p_value;
+			return true;
+		}
+		Container &container = stack[stack.size() - 1];
+		if (container.value.get_type() == Variant::DICTIONARY) {
+			(*VariantInternal::get_dictionary(&container.value))[container.key] = p_value;
+		} else {
+			VariantInternal::get_array(&container.value)->push_back(p_value);
+		}
+		return true;
+	}
+
+	bool _end_container() {
+		const Variant value = stack[stack.size() - 1].value;
+		stack.resize(stack.size() - 1);
+		return _add(value);
+	}
+
+public:
+	Variant result;
+
+	bool begin_object() {
+		stack.push_back({ Dictionary(), String() });
+		return true;
+	}
+	bool object_key(const Span<char> &p_key) {
+		stack[stack.size() - 1].key = String::utf8(p_key);
+		return true;
+	}
+	bool end_object() { return _end_container(); }
+	bool begin_array() {
+		stack.push_back({ Array(), String() });
+		return true;
+	}
+	bool end_array() { return _end_container(); }
+	bool null_value() { return _add(Variant()); }
+	bool bool_value(bool p_value) { return _add(p_value); }
+	bool number_value(double p_value) { return _add(p_value); }
+	bool string_value(const Span<char> &p_value) { return _add(String::utf8(p_value)); }
+};
+
+// Forwards the events to a JSON::EventHandler.
+class JSONEventForwarder {
+	JSON::EventHandler &handler;
+
+public:
+	bool begin_object() { return handler.begin_object(); }
+	bool object_key(const Span<char> &p_key) { return handler.object_key(p_key); }
+	bool end_object() { return handler.end_object(); }
+	bool begin_array() { return handler.begin_array(); }
+	bool end_array() { return handler.end_array(); }
+	bool null_value() { return handler.null_value(); }
+	bool bool_value(bool p_value) { return handler.bool_value(p_value); }
+	bool number_value(double p_value) { return handler.number_value(p_value); }
+	bool string_value(const Span<char> &p_value) { return handler.string_value(p_value); }
+
+	JSONEventForwarder(JSON::EventHandler &p_handler) :
+			handler(p_handler) {}
+};
+
+// Parser working directly on UTF-8 input. It accepts the same documents as JSON::parse()
+// and reports the same errors, but doesn't need the input decoded to a String first, and
+// only creates strings for the values it reports. Strings without escape sequences are
+// passed as views of the input.
+template <typename H>
+class JSONUTF8Parser {
+	struct Token {
+		JSON::TokenType type = JSON::TK_EOF;
+		Span<char> text;
+		double number = 0;
+	};
+
+	const uint8_t *str = nullptr;
+	int64_t len = 0;
+	int64_t index = 0;
+	H &handler;
+
+	LocalVector<char> scratch; // Strings with escape sequences are decoded here.
+
+	static _FORCE_INLINE_ uint64_t _has_byte(uint64_t p_word, uint8_t p_byte) {
+		const uint64_t x = p_word ^ (0x0101010101010101ULL * p_byte);
+		return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+	}
+
+	// Returns the position of the next byte in a string that isn't a plain character
+	// ('"', '\\', '\n' or 0), checking 8 bytes at a time.
+	_FORCE_INLINE_ int64_t _find_string_special(int64_t p_from) const {
+		int64_t i = p_from;
+		while (i + 8 <= len) {
+			uint64_t word;
+			memcpy(&word, str + i, 8);
+			if (_has_byte(word, '"') | _has_byte(word, '\\') | _has_byte(word, '\n') | _has_byte(word, 0)) {
+				break;
+			}
+			i += 8;
+		}
+		while (i < len) {
+			const uint8_t c = str[i];
+			if (c == '"' || c == '\\' || c == '\n' || c == 0) {
+				break;
+			}
+			i++;
+		}
+		return i;
+	}
+
+	_FORCE_INLINE_ uint8_t _at(int64_t p_index) const {
+		return p_index < len ? str[p_index] : 0;
+	}
+
+	void _append_scratch(const uint8_t *p_src, int64_t p_len) {
+		const uint32_t from = scratch.size();
+		scratch.resize(from + p_len);
+		memcpy(scratch.ptr() + from, p_src, p_len);
+	}
+
+	void _append_scratch_char(char32_t p_char) {
+		uint8_t utf8[4];
+		int n = 0;
+		if (p_char <= 0x7f) {
+			utf8[n++] = p_char;
+		} else if (p_char <= 0x7ff) {
+			utf8[n++] = 0xc0 | (p_char >> 6);
+			utf8[n++] = 0x80 | (p_char & 0x3f);
+		} else if (p_char <= 0xffff) {
+			utf8[n++] = 0xe0 | (p_char >> 12);
+			utf8[n++] = 0x80 | ((p_char >> 6) & 0x3f);
+			utf8[n++] = 0x80 | (p_char & 0x3f);
+		} else {
+			utf8[n++] = 0xf0 | (p_char >> 18);
+			utf8[n++] = 0x80 | ((p_char >> 12) & 0x3f);
+			utf8[n++] = 0x80 | ((p_char >> 6) & 0x3f);
+			utf8[n++] = 0x80 | (p_char & 0x3f);
+		}
+		_append_scratch(utf8, n);
+	}
+
+	Error _parse_hex(int64_t p_from, char32_t &r_value) {
+		r_value = 0;
+		for (int j = 0; j < 4; j++) {
+			const uint8_t c = _at(p_from + j);
+			if (c == 0) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			if (!is_hex_digit(c)) {
+				err_str = "Malformed hex constant in string";
+				return ERR_PARSE_ERROR;
+			}
+			char32_t v;
+			if (is_digit(c)) {
+				v = c - '0';
+			} else if (c >= 'a' && c <= 'f') {
+				v = c - 'a' + 10;
+			} else {
+				v = c - 'A' + 10;
+			}
+			r_value = (r_value << 4) | v;
+		}
+		return OK;
+	}
+
+	Error _get_string(Token &r_token) {
+		index++;
+		int64_t run_start = index;
+		bool escaped = false;
+
+		while (true) {
+			index = _find_string_special(index);
+			const uint8_t c = _at(index);
+			if (c == 0) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			if (c == '\n') {
+				line++;
+				index++;
+				continue;
+			}
+			if (c == '"') {
+				if (escaped) {
+					_append_scratch(str + run_start, index - run_start);
+					r_token.text = Span<char>(scratch.ptr(), scratch.size());
+				} else {
+					r_token.text = Span<char>((const char *)str + run_start, index - run_start);
+				}
+				index++;
+				r_token.type = JSON::TK_STRING;
+				return OK;
+			}
+
+			// Escaped characters...
+			if (!escaped) {
+				scratch.clear();
+				escaped = true;
+			}
+			_append_scratch(str + run_start, index - run_start);
+
+			index++;
+			const uint8_t next = _at(index);
+			if (next == 0) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			char32_t res = 0;
+
+			switch (next) {
+				case 'b':
+					res = 8;
+					break;
+				case 't':
+					res = 9;
+					break;
+				case 'n':
+					res = 10;
+					break;
+				case 'f':
+					res = 12;
+					break;
+				case 'r':
+					res = 13;
+					break;
+				case 'u': {
+					Error err = _parse_hex(index + 1, res);
+					if (err != OK) {
+						return err;
+					}
+					index += 4;
+
+					if ((res & 0xfffffc00) == 0xd800) {
+						if (_at(index + 1) != '\\' || _at(index + 2) != 'u') {
+							err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							return ERR_PARSE_ERROR;
+						}
+						index += 2;
+						char32_t trail;
+						err = _parse_hex(index + 1, trail);
+						if (err != OK) {
+							return err;
+						}
+						if ((trail & 0xfffffc00) == 0xdc00) {
+							res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+							index += 4;
+						} else {
+							err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							return ERR_PARSE_ERROR;
+						}
+					} else if ((res & 0xfffffc00) == 0xdc00) {
+						err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
+						return ERR_PARSE_ERROR;
+					}
+				} break;
+				case '"':
+				case '\\':
+				case '/': {
+					res = next;
+				} break;
+				default: {
+					err_str = "Invalid escape sequence";
+					return ERR_PARSE_ERROR;
+				}
+			}
+
+			_append_scratch_char(res);
+			index++;
+			run_start = index;
+		}
+	}
+
+	// Consumes the same characters as String::to_float().
+	void _get_number(Token &r_token) {
+		int64_t end = index;
+		if (_at(end) == '-') {
+			end++;
+		}
+		int mantissa_size = 0;
+		bool decimal_point = false;
+		while (true) {
+			const uint8_t c = _at(end);
+			if (!is_digit(c)) {
+				if (c != '.' || decimal_point) {
+					break;
+				}
+				decimal_point = true;
+			} else {
+				mantissa_size++;
+			}
+			end++;
+		}
+
+		r_token.type = JSON::TK_NUMBER;
+		if (mantissa_size == 0) {
+			r_token.number = 0;
+			return;
+		}
+
+		if (_at(end) == 'e' || _at(end) == 'E') {
+			int64_t exp_end = end + 1;
+			if (_at(exp_end) == '-' || _at(exp_end) == '+') {
+				exp_end++;
+			}
+			if (is_digit(_at(exp_end))) {
+				while (is_digit(_at(exp_end))) {
+					exp_end++;
+				}
+				end = exp_end;
+			}
+		}
+
+		// String::to_float() needs a null-terminated string.
+		char buf[64];
+		const int64_t size = end - index;
+		if (size < (int64_t)sizeof(buf)) {
+			memcpy(buf, str + index, size);
+			buf[size] = 0;
+			r_token.number = String::to_float(buf);
+		} else {
+			CharString long_number;
+			long_number.resize_uninitialized(size + 1);
+			memcpy(long_number.ptrw(), str + index, size);
+			long_number.ptrw()[size] = 0;
+			r_token.number = String::to_float(long_number.get_data());
+		}
+		index = end;
+	}
+
+	Error _get_token(Token &r_token) {
+		while (true) {
+			const uint8_t c = _at(index);
+			switch (c) {
+				case '\n': {
+					line++;
+					index++;
+					break;
+				}
+				case 0: {
+					r_token.type = JSON::TK_EOF;
+					return OK;
+				} break;
+				case '{': {
+					r_token.type = JSON::TK_CURLY_BRACKET_OPEN;
+					index++;
+					return OK;
+				}
+				case '}': {
+					r_token.type = JSON::TK_CURLY_BRACKET_CLOSE;
+					index++;
+					return OK;
+				}
+				case '[': {
+					r_token.type = JSON::TK_BRACKET_OPEN;
+					index++;
+					return OK;
+				}
+				case ']': {
+					r_token.type = JSON::TK_BRACKET_CLOSE;
+					index++;
+					return OK;
+				}
+				case ':': {
+					r_token.type = JSON::TK_COLON;
+					index++;
+					return OK;
+				}
+				case ',': {
+					r_token.type = JSON::TK_COMMA;
+					index++;
+					return OK;
+				}
+				case '"': {
+					return _get_string(r_token);
+				} break;
+				default: {
+					if (c <= 32) {
+						index++;
+						break;
+					}
+
+					if (c == '-' || is_digit(c)) {
+						_get_number(r_token);
+						return OK;
+					} else if (is_ascii_alphabet_char(c)) {
+						const int64_t from = index;
+						while (is_ascii_alphabet_char(_at(index))) {
+							index++;
+						}
+						r_token.type = JSON::TK_IDENTIFIER;
+						r_token.text = Span<char>((const char *)str + from, index - from);
+						return OK;
+					} else {
+						err_str = "Unexpected character";
+						return ERR_PARSE_ERROR;
+					}
+				}
+			}
+		}
+	}
+
+	Error _stopped() {
+		err_str = "Parsing was stopped by the handler";
+		return ERR_SKIP;
+	}
+
+	Error _parse_value(Token &p_token, int p_depth) {
+		if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+			err_str = "JSON structure is too deep";
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		switch (p_token.type) {
+			case JSON::TK_CURLY_BRACKET_OPEN: {
+				if (!handler.begin_object()) {
+					return _stopped();
+				}
+				return _parse_object(p_depth + 1);
+			}
+			case JSON::TK_BRACKET_OPEN: {
+				if (!handler.begin_array()) {
+					return _stopped();
+				}
+				return _parse_array(p_depth + 1);
+			}
+			case JSON::TK_IDENTIFIER: {
+				bool ok;
+				if (p_token.text == Span<char>("true", 4)) {
+					ok = handler.bool_value(true);
+				} else if (p_token.text == Span<char>("false", 5)) {
+					ok = handler.bool_value(false);
+				} else if (p_token.text == Span<char>("null", 4)) {
+					ok = handler.null_value();
+				} else {
+					err_str = vformat("Expected 'true', 'false', or 'null', got '%s'", String::utf8(p_token.text));
+					return ERR_PARSE_ERROR;
+				}
+				return ok ? OK : _stopped();
+			}
+			case JSON::TK_NUMBER: {
+				return handler.number_value(p_token.number) ? OK : _stopped();
+			}
+			case JSON::TK_STRING: {
+				return handler.string_value(p_token.text) ? OK : _stopped();
+			}
+			default: {
+				err_str = vformat("Expected value, got '%s'", String(JSON::tk_name[p_token.type]));
+				return ERR_PARSE_ERROR;
+			}
+		}
+	}
+
+	Error _parse_array(int p_depth) {
+		Token token;
+		bool need_comma = false;
+
+		while (index < len) {
+			Error err = _get_token(token);
+			if (err != OK) {
+				return err;
+			}
+
+			if (token.type == JSON::TK_BRACKET_CLOSE) {
+				return handler.end_array() ? OK : _stopped();
+			}
+
+			if (need_comma) {
+				if (token.type != JSON::TK_COMMA) {
+					err_str = "Expected ','";
+					return ERR_PARSE_ERROR;
+				} else {
+					need_comma = false;
+					continue;
+				}
+			}
+
+			err = _parse_value(token, p_depth);
+			if (err) {
+				return err;
+			}
+			need_comma = true;
+		}
+
+		err_str = "Expected ']'";
+		return ERR_PARSE_ERROR;
+	}
+
+	Error _parse_object(int p_depth) {
+		bool at_key = true;
+		Token token;
+		bool need_comma = false;
+
+		while (index < len) {
+			if (at_key) {
+				Error err = _get_token(token);
+				if (err != OK) {
+					return err;
+				}
+
+				if (token.type == JSON::TK_CURLY_BRACKET_CLOSE) {
+					return handler.end_object() ? OK : _stopped();
+				}
+
+				if (need_comma) {
+					if (token.type != JSON::TK_COMMA) {
+						err_str = "Expected '}' or ','";
+						return ERR_PARSE_ERROR;
+					} else {
+						need_comma = false;
+						continue;
+					}
+				}
+
+				if (token.type != JSON::TK_STRING) {
+					err_str = "Expected key";
+					return ERR_PARSE_ERROR;
+				}
+				// The key may live in the scratch buffer, report it before reading on.
+				if (!handler.object_key(token.text)) {
+					return _stopped();
+				}
+
+				err = _get_token(token);
+				if (err != OK) {
+					return err;
+				}
+				if (token.type != JSON::TK_COLON) {
+					err_str = "Expected ':'";
+					return ERR_PARSE_ERROR;
+				}
+				at_key = false;
+			} else {
+				Error err = _get_token(token);
+				if (err != OK) {
+					return err;
+				}
+
+				err = _parse_value(token, p_depth);
+				if (err) {
+					return err;
+				}
+				need_comma = true;
+				at_key = true;
+			}
+		}
+
+		err_str = "Expected '}'";
+		return ERR_PARSE_ERROR;
+	}
+
+public:
+	String err_str;
+	int line = 0;
+
+	Error parse() {
+		if (len == 0) {
+			err_str = "Unknown error getting token";
+			return ERR_PARSE_ERROR;
+		}
+
+		// Skip the byte order mark, like String::append_utf8() does.
+		if (len >= 3 && str[0] == 0xef && str[1] == 0xbb && str[2] == 0xbf) {
+			index = 3;
+		}
+
+		Token token;
+		Error err = _get_token(token);
+		if (err) {
+			return err;
+		}
+
+		err = _parse_value(token, 0);
+
+		// Check if EOF is reached
+		// or it's a type of the next token.
+		if (err == OK && index < len) {
+			err = _get_token(token);
+
+			if (err || token.type != JSON::TK_EOF) {
+				err_str = "Expected 'EOF'";
+				return ERR_PARSE_ERROR;
+			}
+		}
+
+		return err;
+	}
+
+	JSONUTF8Parser(const uint8_t *p_str, int64_t p_len, H &p_handler) :
+			str(p_str), len(p_len), handler(p_handler) {}
+};
+
+template <typename T>
+void JSON::_add_indent(T &r_result, const String &p_indent, int p_size) {
 	for (int i = 0; i < p_size; i++) {
 		r_result += p_indent;
 	}
 }
 
-void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+template <typename T>
+void JSON::_stringify(T &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
 	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
 		r_result += "...";
 		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
@@ -187,7 +904,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 		}
 		default:
 			r_result += '"';
-			r_result += String(p_var).json_escape();
+			_append_json_escaped(r_result, String(p_var));
 			r_result += '"';
 			return;
 	}
@@ -606,6 +1323,38 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_utf8_buffer(const Vector<uint8_t> &p_json_buffer, bool p_keep_text) {
+	JSONVariantBuilder builder;
+	JSONUTF8Parser<JSONVariantBuilder> parser(p_json_buffer.ptr(), p_json_buffer.size(), builder);
+	Error err = parser.parse();
+	if (err == OK) {
+		data = builder.result;
+		err_str = String();
+		err_line = 0;
+	} else {
+		data = Variant();
+		err_str = parser.err_str;
+		err_line = parser.line;
+	}
+	if (p_keep_text) {
+		text = String::utf8((const char *)p_json_buffer.ptr(), p_json_buffer.size());
+	}
+	return err;
+}
+
+Error JSON::parse_utf8_events(const Span<uint8_t> &p_json_buffer, EventHandler &p_handler, String *r_err_str, int *r_err_line) {
+	JSONEventForwarder forwarder(p_handler);
+	JSONUTF8Parser<JSONEventForwarder> parser(p_json_buffer.ptr(), p_json_buffer.size(), forwarder);
+	Error err = parser.parse();
+	if (r_err_str) {
+		*r_err_str = err == OK ? String() : parser.err_str;
+	}
+	if (r_err_line) {
+		*r_err_line = err == OK ? 0 : parser.line;
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
@@ -617,6 +1366,13 @@ String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort
 	return result;
 }
 
+Vector<uint8_t> JSON::stringify_to_utf8_buffer(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	JSONUTF8Writer result;
+	HashSet<const void *> markers;
+	_stringify(result, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+	return result.finish();
+}
+
 Variant JSON::parse_string(const String &p_json_string) {
 	Ref<JSON> json;
 	json.instantiate();
@@ -629,6 +1385,8 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_static_method("JSON", D_METHOD("stringify_to_utf8_buffer", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify_to_utf8_buffer, DEFVAL(""), DEFVAL(true), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_utf8_buffer", "json_buffer", "keep_text"), &JSON::parse_utf8_buffer, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -1563,7 +2321,7 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err = json->parse_utf8_buffer(FileAccess::get_file_as_bytes(p_path), Engine::get_singleton()->is_editor_hint());
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
@@ -1605,14 +2363,16 @@ Error ResourceFormatSaverJSON::save(const Ref<Resource> &p_resource, const Strin
 	Ref<JSON> json = p_resource;
 	ERR_FAIL_COND_V(json.is_null(), ERR_INVALID_PARAMETER);
 
-	String source = json->get_parsed_text().is_empty() ? JSON::stringify(json->get_data(), "\t", false, true) : json->get_parsed_text();
-
 	Error err;
 	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE, &err);
 
 	ERR_FAIL_COND_V_MSG(err, err, vformat("Cannot save json '%s'.", p_path));
 
-	file->store_string(source);
+	if (json->get_parsed_text().is_empty()) {
+		file->store_buffer(JSON::stringify_to_utf8_buffer(json->get_data(), "\t", false, true));
+	} else {
+		file->store_string(json->get_parsed_text());
+	}
 	if (file->get_error() != OK && file->get_error() != ERR_FILE_EOF) {
 		return ERR_CANT_CREATE;
 	}
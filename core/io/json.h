@@ -33,11 +33,18 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/span.h"
 #include "core/variant/variant.h"
 
+template <typename T>
+class JSONUTF8Parser;
+
 class JSON : public Resource {
 	GDCLASS(JSON, Resource);
 
+	template <typename>
+	friend class JSONUTF8Parser;
+
 	enum TokenType {
 		TK_CURLY_BRACKET_OPEN,
 		TK_CURLY_BRACKET_CLOSE,
@@ -71,8 +78,10 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static void _add_indent(String &r_result, const String &p_indent, int p_size);
-	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
+	template <typename T>
+	static void _add_indent(T &r_result, const String &p_indent, int p_size);
+	template <typename T>
+	static void _stringify(T &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
 	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
 	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
@@ -86,11 +95,32 @@ protected:
 	static void _bind_methods();
 
 public:
+	// Receives the content of a document parsed by parse_utf8_events() as it is read, so large
+	// documents can be processed without building a Variant tree. Strings are passed as UTF-8
+	// and are only valid during the call. Returning false stops parsing with ERR_SKIP.
+	class EventHandler {
+	public:
+		virtual bool begin_object() = 0;
+		virtual bool object_key(const Span<char> &p_key) = 0;
+		virtual bool end_object() = 0;
+		virtual bool begin_array() = 0;
+		virtual bool end_array() = 0;
+		virtual bool null_value() = 0;
+		virtual bool bool_value(bool p_value) = 0;
+		virtual bool number_value(double p_value) = 0;
+		virtual bool string_value(const Span<char> &p_value) = 0;
+
+		virtual ~EventHandler() {}
+	};
+
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_utf8_buffer(const Vector<uint8_t> &p_json_buffer, bool p_keep_text = false);
 	String get_parsed_text() const;
 
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
+	static Vector<uint8_t> stringify_to_utf8_buffer(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
+	static Error parse_utf8_events(const Span<uint8_t> &p_json_buffer, EventHandler &p_handler, String *r_err_str = nullptr, int *r_err_line = nullptr);
 
 	_FORCE_INLINE_ static Variant from_native(const Variant &p_variant, bool p_full_objects = false) {
 		return _from_native(p_variant, p_full_objects, 0);
@@ -31,11 +31,17 @@
 #include "pck_packer.h"
 
 #include "core/crypto/crypto_core.h"
+#include "core/io/compression.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
+#include "core/io/marshalls.h"
 #include "core/version.h"
 
+// Uncompressed size of the blocks of compressed files, only the block containing
+// the read position has to be decompressed when seeking.
+static constexpr uint32_t COMPRESSED_BLOCK_SIZE = 64 * 1024;
+
 static int _get_pad(int p_alignment, int p_n) {
 	int rest = p_n % p_alignment;
 	int pad = 0;
@@ -46,11 +52,97 @@ static int _get_pad(int p_alignment, int p_n) {
 	return pad;
 }
 
+// Writes `p_data` in the FileAccessCompressed block format, which is what FileAccessPack
+// expects for entries flagged with PACK_FILE_COMPRESSED.
+static bool _compress_file_data(const Vector<uint8_t> &p_data, Vector<uint8_t> &r_compressed, uint32_t p_zstd_dictionary_id) {
+	const uint64_t total = p_data.size();
+	if (total > UINT32_MAX) {
+		return false; // The block format stores the uncompressed size as 32-bit.
+	}
+
+	const uint32_t block_count = total / COMPRESSED_BLOCK_SIZE + 1;
+	const uint64_t header_size = 16 + uint64_t(block_count) * 4;
+	const int64_t max_block_size = Compression::get_max_compressed_buffer_size(COMPRESSED_BLOCK_SIZE, Compression::MODE_ZSTD);
+	ERR_FAIL_COND_V(max_block_size < 0, false);
+
+	r_compressed.resize(header_size + uint64_t(block_count) * max_block_size);
+	uint8_t *w = r_compressed.ptrw();
+
+	memcpy(w, PACK_FILE_COMPRESSED_MAGIC, 4);
+	encode_uint32(Compression::MODE_ZSTD | (p_zstd_dictionary_id << 8), w + 4);
+	encode_uint32(COMPRESSED_BLOCK_SIZE, w + 8);
+	encode_uint32(uint32_t(total), w + 12);
+
+	uint64_t ofs = header_size;
+	for (uint32_t i = 0; i < block_count; i++) {
+		const uint64_t from = uint64_t(i) * COMPRESSED_BLOCK_SIZE;
+		const int64_t block_size = MIN(uint64_t(COMPRESSED_BLOCK_SIZE), total - from);
+
+		const int64_t compressed_size = Compression::compress(w + ofs, p_data.ptr() + from, block_size, Compression::MODE_ZSTD, p_zstd_dictionary_id);
+		ERR_FAIL_COND_V_MSG(compressed_size < 0, false, "PCKPacker: Error compressing data.");
+
+		encode_uint32(uint32_t(compressed_size), w + 16 + i * 4);
+		ofs += compressed_size;
+	}
+
+	r_compressed.resize(ofs);
+	return true;
+}
+
 void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pck_start", "pck_path", "alignment", "key", "encrypt_directory"), &PCKPacker::pck_start, DEFVAL(32), DEFVAL("0000000000000000000000000000000000000000000000000000000000000000"), DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
+
+	ClassDB::bind_method(D_METHOD("set_compression_enabled", "enabled"), &PCKPacker::set_compression_enabled);
+	ClassDB::bind_method(D_METHOD("is_compression_enabled"), &PCKPacker::is_compression_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_zstd_dictionary", "dictionary"), &PCKPacker::set_zstd_dictionary);
+	ClassDB::bind_method(D_METHOD("get_zstd_dictionary"), &PCKPacker::get_zstd_dictionary);
+
+	ClassDB::bind_static_method("PCKPacker", D_METHOD("train_zstd_dictionary", "source_paths", "max_size"), &PCKPacker::train_zstd_dictionary, DEFVAL(Compression::ZSTD_DICTIONARY_DEFAULT_MAX_SIZE));
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compression_enabled"), "set_compression_enabled", "is_compression_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "zstd_dictionary"), "set_zstd_dictionary", "get_zstd_dictionary");
+}
+
+void PCKPacker::set_compression_enabled(bool p_enabled) {
+	compression_enabled = p_enabled;
+}
+
+bool PCKPacker::is_compression_enabled() const {
+	return compression_enabled;
+}
+
+void PCKPacker::set_zstd_dictionary(const Vector<uint8_t> &p_dictionary) {
+	if (p_dictionary.is_empty()) {
+		zstd_dictionary.clear();
+		zstd_dictionary_id = 0;
+		return;
+	}
+
+	const uint32_t id = Compression::get_zstd_dictionary_id(p_dictionary);
+	// Registered right away so files using it can be compressed (and read back by this process).
+	ERR_FAIL_COND(Compression::register_zstd_dictionary(id, p_dictionary) != OK);
+	zstd_dictionary = p_dictionary;
+	zstd_dictionary_id = id;
+}
+
+Vector<uint8_t> PCKPacker::get_zstd_dictionary() const {
+	return zstd_dictionary;
+}
+
+Vector<uint8_t> PCKPacker::train_zstd_dictionary(const Vector<String> &p_source_paths, int p_max_size) {
+	Vector<Vector<uint8_t>> samples;
+	for (const String &path : p_source_paths) {
+		Error err;
+		Vector<uint8_t> sample = FileAccess::get_file_as_bytes(path, &err);
+		ERR_CONTINUE_MSG(err != OK, vformat("Can't read sample file \"%s\".", path));
+		samples.push_back(sample);
+	}
+
+	return Compression::train_zstd_dictionary(samples, p_max_size);
 }
 
 Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const String &p_key, bool p_encrypt_directory) {
@@ -123,6 +215,8 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	file->seek(file_base);
 
 	files.clear();
+	stored_data.clear();
+	used_zstd_dictionaries.clear();
 
 	return OK;
 }
@@ -145,6 +239,36 @@ Error PCKPacker::add_file_removal(const String &p_target_path) {
 	return OK;
 }
 
+Error PCKPacker::_store_data(File &r_file, const Vector<uint8_t> &p_data, bool p_encrypt) {
+	r_file.ofs = file->get_position();
+
+	Ref<FileAccess> ftmp = file;
+
+	Ref<FileAccessEncrypted> fae;
+	if (p_encrypt) {
+		fae.instantiate();
+		ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
+
+		Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+		ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
+		ftmp = fae;
+	}
+
+	ftmp->store_buffer(p_data);
+
+	if (fae.is_valid()) {
+		ftmp.unref();
+		fae.unref();
+	}
+
+	int pad = _get_pad(alignment, file->get_position());
+	for (int j = 0; j < pad; j++) {
+		file->store_8(0);
+	}
+
+	return OK;
+}
+
 Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
@@ -172,30 +296,45 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 	}
 	pf.encrypted = p_encrypt;
 
-	Ref<FileAccess> ftmp = file;
-
-	Ref<FileAccessEncrypted> fae;
-	if (p_encrypt) {
-		fae.instantiate();
-		ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
-
-		Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
-		ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
-		ftmp = fae;
+	// Identical content stored with the same options is written once, later files point to it.
+	String content_key;
+	{
+		unsigned char hash[32];
+		CryptoCore::sha256(data.ptr(), data.size(), hash);
+		content_key = String::hex_encode_buffer(hash, 32) + itos(data.size()) + (p_encrypt ? "e" : "") + (compression_enabled ? "c" + itos(zstd_dictionary_id) : "");
 	}
 
-	ftmp->store_buffer(data);
+	HashMap<String, StoredData>::ConstIterator E = stored_data.find(content_key);
+	if (E) {
+		pf.ofs = E->value.ofs;
+		pf.compressed = E->value.compressed;
+		files.push_back(pf);
+		return OK;
+	}
 
-	if (fae.is_valid()) {
-		ftmp.unref();
-		fae.unref();
+	if (compression_enabled && !data.is_empty()) {
+		Vector<uint8_t> compressed;
+		// Keep incompressible files (already compressed textures, audio, ...) as-is,
+		// they would only cost decompression time when loaded.
+		if (_compress_file_data(data, compressed, zstd_dictionary_id) && compressed.size() < data.size() - data.size() / 16) {
+			data = compressed;
+			pf.compressed = true;
+			if (zstd_dictionary_id != 0) {
+				used_zstd_dictionaries[zstd_dictionary_id] = zstd_dictionary;
+			}
+		}
 	}
 
-	int pad = _get_pad(alignment, file->get_position());
-	for (int j = 0; j < pad; j++) {
-		file->store_8(0);
+	Error err = _store_data(pf, data, p_encrypt);
+	if (err != OK) {
+		return err;
 	}
 
+	StoredData sd;
+	sd.ofs = pf.ofs;
+	sd.compressed = pf.compressed;
+	stored_data.insert(content_key, sd);
+
 	files.push_back(pf);
 
 	return OK;
@@ -204,6 +343,26 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
+	// Readers need the dictionaries before opening any file compressed with them.
+	for (const KeyValue<uint32_t, Vector<uint8_t>> &E : used_zstd_dictionaries) {
+		File pf;
+		pf.path = PACK_ZSTD_DICTIONARY_DIR + itos(E.key) + ".zdict";
+		pf.src_path = pf.path;
+		pf.size = E.value.size();
+
+		unsigned char hash[16];
+		CryptoCore::md5(E.value.ptr(), E.value.size(), hash);
+		pf.md5.resize(16);
+		for (int i = 0; i < 16; i++) {
+			pf.md5.write[i] = hash[i];
+		}
+
+		Error err = _store_data(pf, E.value, false);
+		ERR_FAIL_COND_V(err != OK, err);
+		files.push_back(pf);
+	}
+	used_zstd_dictionaries.clear();
+
 	int dir_padding = _get_pad(alignment, file->get_position());
 	for (int i = 0; i < dir_padding; i++) {
 		file->store_8(0);
@@ -253,6 +412,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 
 		if (p_verbose) {
@@ -30,7 +30,9 @@
 
 #pragma once
 
+#include "core/io/compression.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/hash_map.h"
 
 class FileAccess;
 
@@ -47,6 +49,10 @@ class PCKPacker : public RefCounted {
 	uint64_t file_base_ofs = 0;
 	uint64_t dir_base_ofs = 0;
 
+	bool compression_enabled = false;
+	Vector<uint8_t> zstd_dictionary;
+	uint32_t zstd_dictionary_id = 0;
+
 	static void _bind_methods();
 
 	struct File {
@@ -56,15 +62,36 @@ class PCKPacker : public RefCounted {
 		uint64_t size = 0;
 		bool encrypted = false;
 		bool removal = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
 
+	// Files with identical content (and storage flags) share their data in the pack.
+	struct StoredData {
+		uint64_t ofs = 0;
+		bool compressed = false;
+	};
+	HashMap<String, StoredData> stored_data;
+
+	// Dictionaries used by compressed files, stored in the pack when flushing.
+	HashMap<uint32_t, Vector<uint8_t>> used_zstd_dictionaries;
+
+	Error _store_data(File &r_file, const Vector<uint8_t> &p_data, bool p_encrypt);
+
 public:
 	Error pck_start(const String &p_pck_path, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
 	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false);
 	Error add_file_removal(const String &p_target_path);
 	Error flush(bool p_verbose = false);
 
+	void set_compression_enabled(bool p_enabled);
+	bool is_compression_enabled() const;
+
+	void set_zstd_dictionary(const Vector<uint8_t> &p_dictionary);
+	Vector<uint8_t> get_zstd_dictionary() const;
+
+	static Vector<uint8_t> train_zstd_dictionary(const Vector<String> &p_source_paths, int p_max_size = Compression::ZSTD_DICTIONARY_DEFAULT_MAX_SIZE);
+
 	~PCKPacker();
 };
@@ -33,8 +33,10 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/property_utils.h"
 #include "scene/resources/packed_scene.h"
@@ -445,23 +447,18 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
-					} else {
-						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
-						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
-							Error err;
-							Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
-							if (res.is_null()) {
-								if (!ResourceLoader::is_cleaning_tasks()) {
-									if (!ResourceLoader::get_abort_on_missing_resources()) {
-										ResourceLoader::notify_dependency_error(local_path, external_resources[erindex].path, external_resources[erindex].type);
-									} else {
-										error = ERR_FILE_MISSING_DEPENDENCIES;
-										ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", external_resources[erindex].path));
-									}
-								}
-							} else {
-								r_v = res;
-							}
+					} else if (external_resources[erindex].completed) {
+						if (external_resources[erindex].resource.is_valid()) {
+							r_v = external_resources[erindex].resource;
+						}
+					} else if (external_resources[erindex].load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
+						Ref<Resource> res;
+						Error err = _complete_external_resource(erindex, res);
+						if (err) {
+							return err;
+						}
+						if (res.is_valid()) {
+							r_v = res;
 						}
 					}
 				} break;
@@ -674,139 +671,382 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 	return OK; //never reach anyway
 }
 
+Error ResourceLoaderBinary::_complete_external_resource(int p_index, Ref<Resource> &r_res) {
+	Error err;
+	r_res = ResourceLoader::_load_complete(*external_resources[p_index].load_token.ptr(), &err);
+	if (r_res.is_null() && !ResourceLoader::is_cleaning_tasks()) {
+		if (!ResourceLoader::get_abort_on_missing_resources()) {
+			ResourceLoader::notify_dependency_error(local_path, external_resources[p_index].path, external_resources[p_index].type);
+		} else {
+			error = ERR_FILE_MISSING_DEPENDENCIES;
+			ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", external_resources[p_index].path));
+		}
+	}
+	return OK;
+}
+
 Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource, bool &r_skip) {
+	bool main = p_index == (internal_resources.size() - 1);
+
+	//maybe it is loaded already
+	String path;
+	String id;
+
+	if (!main) {
+		path = internal_resources[p_index].path;
+
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
+		}
+
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				internal_index_cache[path] = cached;
+				r_skip = true;
+				return OK;
+			}
+		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	uint64_t offset = internal_resources[p_index].offset;
 
-		if (remaps.has(path)) {
-			path = remaps[path];
+	f->seek(offset);
+
+	String t = get_unicode_string();
+
+	Ref<Resource> res;
+	Resource *r = nullptr;
+
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
+			}
 		}
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					r_missing_resource = memnew(MissingResource);
+					r_missing_resource->set_original_class(t);
+					r_missing_resource->set_recording_properties(true);
+					obj = r_missing_resource;
+				} else {
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
+				}
+			}
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
+			}
+
+			res = Ref<Resource>(r);
 		}
+	}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
 			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+				r->set_path_cache(path);
 			}
 		}
+		r->set_scene_unique_id(id);
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	r_res = res;
+	return OK;
+}
 
-		if (!main) {
-			path = internal_resources[i].path;
+void ResourceLoaderBinary::_set_internal_resource_property(const Ref<Resource> &p_res, const MissingResource *p_missing_resource, const StringName &p_name, Variant &p_value, Dictionary &r_missing_resource_properties) {
+	bool set_valid = true;
+	if (p_value.get_type() == Variant::OBJECT && p_missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+		// If the property being set is a missing resource (and the parent is not),
+		// then setting it will most likely not work.
+		// Instead, save it as metadata.
+
+		Ref<MissingResource> mr = p_value;
+		if (mr.is_valid()) {
+			r_missing_resource_properties[p_name] = mr;
+			set_valid = false;
+		}
+	}
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	if (p_value.get_type() == Variant::ARRAY) {
+		Array set_array = p_value;
+		bool is_get_valid = false;
+		Variant get_value = p_res->get(p_name, &is_get_valid);
+		if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+			Array get_array = get_value;
+			if (!set_array.is_same_typed(get_array)) {
+				p_value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
+			}
+		}
+	}
 
-				internal_resources.write[i].path = path; // Update path.
+	if (p_value.get_type() == Variant::DICTIONARY) {
+		Dictionary set_dict = p_value;
+		bool is_get_valid = false;
+		Variant get_value = p_res->get(p_name, &is_get_valid);
+		if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+			Dictionary get_dict = get_value;
+			if (!set_dict.is_same_typed(get_dict)) {
+				p_value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+						get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
 			}
+		}
+	}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
-				}
+	if (set_valid) {
+		p_res->set(p_name, p_value);
+	}
+}
+
+void ResourceLoaderBinary::_finish_internal_resource(int p_index, const Ref<Resource> &p_res, MissingResource *p_missing_resource, const Dictionary &p_missing_resource_properties) {
+	if (p_missing_resource) {
+		p_missing_resource->set_recording_properties(false);
+	}
+
+	if (!p_missing_resource_properties.is_empty()) {
+		p_res->set_meta(META_MISSING_RESOURCES, p_missing_resource_properties);
+	}
+
+#ifdef TOOLS_ENABLED
+	p_res->set_edited(false);
+#endif
+
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+
+	resource_cache.push_back(p_res);
+
+	if (p_index == internal_resources.size() - 1) {
+		f.unref();
+		resource = p_res;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+	}
+}
+
+void ResourceLoaderBinary::_decode_properties_task(DecodeTask *p_task) {
+	ParallelDecode *decode = p_task->decode;
+	ResourceLoaderBinary &decoder = decode->decoders[p_task->decoder];
+	const uint32_t decoder_count = decode->decoders.size();
+
+	// Resources are interleaved between decoders, so large and small ones spread evenly.
+	for (uint32_t i = p_task->decoder; i < decode->pending.size(); i += decoder_count) {
+		PendingResource &pending = decode->pending[i];
+
+		decoder.f->seek(pending.properties_offset);
+		int pc = decoder.f->get_32();
+		pending.properties.reserve(pc);
+
+		for (int j = 0; j < pc; j++) {
+			StringName name = decoder._get_string();
+			if (name == StringName()) {
+				pending.error = ERR_FILE_CORRUPT;
+				break;
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			Variant value;
+			pending.error = decoder.parse_variant(value);
+			if (pending.error) {
+				break;
 			}
+
+			pending.properties.push_back(Pair<StringName, Variant>(name, value));
 		}
+	}
+}
 
-		uint64_t offset = internal_resources[i].offset;
+Error ResourceLoaderBinary::_load_internal_resources_parallel() {
+	ParallelDecode decode;
 
-		f->seek(offset);
+	// Resources are created and registered in the internal cache first, so references
+	// between them can be resolved while decoding, without further writes to shared state.
+	for (int i = 0; i < internal_resources.size(); i++) {
+		PendingResource pending;
+		pending.index = i;
+		bool skip = false;
 
-		String t = get_unicode_string();
+		error = _create_internal_resource(i, pending.res, pending.missing_resource, skip);
+		if (error) {
+			return error;
+		}
+		if (skip) {
+			continue;
+		}
 
+		pending.properties_offset = f->get_position();
+		decode.pending.push_back(pending);
+	}
+
+	// Waiting on external loads from the decoding tasks could block workers, complete them now.
+	for (int i = 0; i < external_resources.size(); i++) {
+		if (external_resources[i].load_token.is_null()) {
+			continue;
+		}
 		Ref<Resource> res;
-		Resource *r = nullptr;
+		error = _complete_external_resource(i, res);
+		if (error) {
+			return error;
+		}
+		external_resources.write[i].resource = res;
+		external_resources.write[i].completed = true;
+	}
+
+	// Every decoder reads from its own cursor over the file contents, which are
+	// a view of the mapped pack when possible.
+	Vector<uint8_t> file_data;
+	f->seek(0);
+	const uint64_t file_length = f->get_length();
+	Span<uint8_t> view = f->get_buffer_view(file_length);
+	if (view.size() != file_length) {
+		file_data.resize(file_length);
+		f->seek(0);
+		ERR_FAIL_COND_V(f->get_buffer(file_data.ptrw(), file_length) != file_length, ERR_FILE_CORRUPT);
+		view = Span<uint8_t>(file_data.ptr(), file_length);
+	}
+
+	const uint32_t decoder_count = MIN(decode.pending.size(), (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count() + 1);
+	decode.decoders.resize(decoder_count);
+	for (ResourceLoaderBinary &decoder : decode.decoders) {
+		Ref<FileAccessMemory> fm;
+		fm.instantiate();
+		fm->open_custom(view.ptr(), view.size());
+		fm->set_big_endian(f->is_big_endian());
+		fm->real_is_double = f->real_is_double;
+
+		decoder.f = fm;
+		decoder.ver_format = ver_format;
+		decoder.using_named_scene_ids = using_named_scene_ids;
+		decoder.local_path = local_path;
+		decoder.res_path = res_path;
+		decoder.string_map = string_map;
+		decoder.internal_resources = internal_resources;
+		decoder.internal_index_cache = internal_index_cache;
+		decoder.external_resources = external_resources;
+		decoder.remaps = remaps;
+		decoder.cache_mode_for_external = cache_mode_for_external;
+	}
+
+	// Threaded loads already run on the pool, so the calling thread decodes as well and waits on
+	// individual tasks, which lets it run pending work instead of blocking a worker.
+	LocalVector<DecodeTask> tasks;
+	tasks.resize(decoder_count);
+	LocalVector<WorkerThreadPool::TaskID> task_ids;
+	for (uint32_t i = 0; i < decoder_count; i++) {
+		tasks[i].decode = &decode;
+		tasks[i].decoder = i;
+		if (i > 0) {
+			task_ids.push_back(WorkerThreadPool::get_singleton()->add_template_task(this, &ResourceLoaderBinary::_decode_properties_task, &tasks[i], false, vformat("ResourceLoaderBinaryDecode:%s", local_path)));
+		}
+	}
+	_decode_properties_task(&tasks[0]);
+	for (WorkerThreadPool::TaskID task_id : task_ids) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+	}
 
-		MissingResource *missing_resource = nullptr;
+	// Properties are set in file order, as in a sequential load.
+	for (PendingResource &pending : decode.pending) {
+		if (pending.error) {
+			error = pending.error;
+			ERR_FAIL_V_MSG(error, vformat("'%s': Error when decoding resource properties.", local_path));
+		}
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+		Dictionary missing_resource_properties;
+		for (Pair<StringName, Variant> &property : pending.properties) {
+			_set_internal_resource_property(pending.res, pending.missing_resource, property.first, property.second, missing_resource_properties);
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
-			}
+		pending.properties.clear();
 
-			if (res.is_null()) {
-				//did not replace
+		_finish_internal_resource(pending.index, pending.res, pending.missing_resource, missing_resource_properties);
+	}
 
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
+	if (resource.is_null()) {
+		return ERR_FILE_EOF;
+	}
+	return OK;
+}
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
-				}
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
 
-				res = Ref<Resource>(r);
-			}
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
+
+		if (remaps.has(path)) {
+			path = remaps[path];
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
-				}
+		if (!path.contains("://") && path.is_relative_path()) {
+			// path is relative to file being loaded, so convert to a resource path
+			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		}
+
+		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+		if (external_resources[i].load_token.is_null()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
 			}
-			r->set_scene_unique_id(id);
 		}
+	}
+
+	if (use_sub_threads && using_named_scene_ids && internal_resources.size() >= PARALLEL_DECODE_MIN_RESOURCES) {
+		return _load_internal_resources_parallel();
+	}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+	for (int i = 0; i < internal_resources.size(); i++) {
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		bool skip = false;
+
+		error = _create_internal_resource(i, res, missing_resource, skip);
+		if (error) {
+			return error;
+		}
+		if (skip) {
+			continue;
 		}
 
 		int pc = f->get_32();
@@ -830,72 +1070,12 @@ Error ResourceLoaderBinary::load() {
 				return error;
 			}
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
-
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
-			}
-
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
-				}
-			}
-
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
-				}
-			}
-
-			if (set_valid) {
-				res->set(name, value);
-			}
+			_set_internal_resource_property(res, missing_resource, name, value, missing_resource_properties);
 		}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
-		}
-
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
-		}
-
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
-
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
-		}
+		_finish_internal_resource(i, res, missing_resource, missing_resource_properties);
 
-		resource_cache.push_back(res);
-
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
+		if (i == internal_resources.size() - 1) {
 			return OK;
 		}
 	}
@@ -33,8 +33,12 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
 #include "core/templates/rb_map.h"
 
+class MissingResource;
+
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
 	String local_path;
@@ -61,6 +65,9 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		// Set when the load was completed up front, so it can be read from several threads.
+		bool completed = false;
+		Ref<Resource> resource;
 	};
 
 	bool using_named_scene_ids = false;
@@ -78,6 +85,28 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	// Internal resources whose properties are decoded on WorkerThreadPool, then set in file order.
+	struct PendingResource {
+		int index = 0;
+		Ref<Resource> res;
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		LocalVector<Pair<StringName, Variant>> properties;
+		Error error = OK;
+	};
+
+	struct ParallelDecode {
+		LocalVector<PendingResource> pending;
+		LocalVector<ResourceLoaderBinary> decoders;
+	};
+
+	struct DecodeTask {
+		ParallelDecode *decode = nullptr;
+		uint32_t decoder = 0;
+	};
+
+	static constexpr int PARALLEL_DECODE_MIN_RESOURCES = 16;
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
@@ -90,6 +119,14 @@ class ResourceLoaderBinary {
 	friend class ResourceFormatLoaderBinary;
 
 	Error parse_variant(Variant &r_v);
+	Error _complete_external_resource(int p_index, Ref<Resource> &r_res);
+
+	Error _create_internal_resource(int p_index, Ref<Resource> &r_res, MissingResource *&r_missing_resource, bool &r_skip);
+	void _set_internal_resource_property(const Ref<Resource> &p_res, const MissingResource *p_missing_resource, const StringName &p_name, Variant &p_value, Dictionary &r_missing_resource_properties);
+	void _finish_internal_resource(int p_index, const Ref<Resource> &p_res, MissingResource *p_missing_resource, const Dictionary &p_missing_resource_properties);
+
+	void _decode_properties_task(DecodeTask *p_task);
+	Error _load_internal_resources_parallel();
 
 	HashMap<String, Ref<Resource>> dependency_cache;
 
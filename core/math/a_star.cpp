@@ -32,6 +32,9 @@
 #include "a_star.compat.inc"
 
 #include "core/math/geometry_3d.h"
+#include "core/object/worker_thread_pool.h"
+
+#include <typeinfo>
 
 int64_t AStar3D::get_available_point_id() const {
 	if (points.has(last_free_id)) {
@@ -56,15 +59,17 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->id = p_id;
 		pt->pos = p_pos;
 		pt->weight_scale = p_weight_scale;
-		pt->prev_point = nullptr;
-		pt->open_pass = 0;
-		pt->closed_pass = 0;
 		pt->enabled = true;
 		points.insert_new(p_id, pt);
+		solve_graph_dirty.set();
 	} else {
 		Point *found_pt = *point_entry;
 		found_pt->pos = p_pos;
 		found_pt->weight_scale = p_weight_scale;
+		if (!solve_graph_dirty.is_set()) {
+			solve_positions[found_pt->solve_index] = p_pos;
+			solve_weight_scales[found_pt->solve_index] = p_weight_scale;
+		}
 	}
 }
 
@@ -80,6 +85,9 @@ void AStar3D::set_point_position(int64_t p_id, const Vector3 &p_pos) {
 	ERR_FAIL_COND_MSG(!point_entry, vformat("Can't set point's position. Point with id: %d doesn't exist.", p_id));
 
 	(*point_entry)->pos = p_pos;
+	if (!solve_graph_dirty.is_set()) {
+		solve_positions[(*point_entry)->solve_index] = p_pos;
+	}
 }
 
 real_t AStar3D::get_point_weight_scale(int64_t p_id) const {
@@ -95,6 +103,9 @@ void AStar3D::set_point_weight_scale(int64_t p_id, real_t p_weight_scale) {
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
 
 	(*point_entry)->weight_scale = p_weight_scale;
+	if (!solve_graph_dirty.is_set()) {
+		solve_weight_scales[(*point_entry)->solve_index] = p_weight_scale;
+	}
 }
 
 void AStar3D::remove_point(int64_t p_id) {
@@ -121,6 +132,7 @@ void AStar3D::remove_point(int64_t p_id) {
 	memdelete(p);
 	points.erase(p_id);
 	last_free_id = p_id;
+	solve_graph_dirty.set();
 }
 
 void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional) {
@@ -159,6 +171,7 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 	}
 
 	segments.insert(s);
+	solve_graph_dirty.set();
 }
 
 void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectional) {
@@ -198,6 +211,7 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectio
 		if (s.direction != Segment::NONE) {
 			segments.insert(s);
 		}
+		solve_graph_dirty.set();
 	}
 }
 
@@ -243,6 +257,7 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	solve_graph_dirty.set();
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -306,78 +321,237 @@ Vector3 AStar3D::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
-bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_path) {
-	last_closest_point = nullptr;
-	pass++;
+void AStar3D::_update_solve_graph() {
+	if (!solve_graph_dirty.is_set()) {
+		return;
+	}
+
+	MutexLock lock(solve_graph_mutex);
+	if (!solve_graph_dirty.is_set()) {
+		return; // Another thread updated it already.
+	}
+
+	const uint32_t point_count = points.size();
+	solve_points.resize(point_count);
+	solve_ids.resize(point_count);
+	solve_positions.resize(point_count);
+	solve_weight_scales.resize(point_count);
+	solve_enabled.resize(point_count);
+	solve_neighbor_offsets.resize(point_count + 1);
+
+	uint32_t solve_index = 0;
+	uint32_t neighbor_count = 0;
+	for (const KeyValue<int64_t, Point *> &kv : points) {
+		Point *point = kv.value;
+		point->solve_index = solve_index;
+		solve_points[solve_index] = point;
+		solve_ids[solve_index] = point->id;
+		solve_positions[solve_index] = point->pos;
+		solve_weight_scales[solve_index] = point->weight_scale;
+		solve_enabled[solve_index] = point->enabled;
+		solve_neighbor_offsets[solve_index] = neighbor_count;
+		neighbor_count += point->neighbors.size();
+		solve_index++;
+	}
+	solve_neighbor_offsets[point_count] = neighbor_count;
+
+	solve_neighbors.resize(neighbor_count);
+	uint32_t neighbor_index = 0;
+	for (const Point *point : solve_points) {
+		for (const KeyValue<int64_t, Point *> &kv : point->neighbors) {
+			solve_neighbors[neighbor_index++] = kv.value->solve_index;
+		}
+	}
+
+	solve_graph_version++;
+	solve_graph_dirty.clear();
+}
+
+AStar3D::SolveState *AStar3D::_acquire_solve_state() {
+	SolveState *state = nullptr;
+	{
+		MutexLock lock(solve_states_mutex);
+		if (!solve_states.is_empty()) {
+			state = solve_states[solve_states.size() - 1];
+			solve_states.remove_at(solve_states.size() - 1);
+		}
+	}
+	if (!state) {
+		state = memnew(SolveState);
+	}
+
+	if (state->graph_version != solve_graph_version) {
+		// The previous values can't be matched to points anymore.
+		state->points.clear();
+		state->points.resize(solve_points.size());
+		state->graph_version = solve_graph_version;
+	}
+
+	return state;
+}
+
+void AStar3D::_release_solve_state(SolveState *p_state) {
+	MutexLock lock(solve_states_mutex);
+	solve_states.push_back(p_state);
+}
+
+bool AStar3D::_filter_neighbor(int64_t p_from_id, int64_t p_neighbor_id) {
+	bool filtered;
+	return GDVIRTUAL_CALL(_filter_neighbor, p_from_id, p_neighbor_id, filtered) && filtered;
+}
+
+bool AStar3D::_is_solve_thread_safe() const {
+	// Script callbacks must not be called from worker threads.
+	return !neighbor_filter_enabled && !GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) && !GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+}
+
+bool AStar3D::_has_default_costs() const {
+	// When neither cost is overridden, by a script or a C++ subclass, both are the distance between the points,
+	// which the solve can take from solve_positions instead of looking the points up by ID.
+	return typeid(*this) == typeid(AStar3D) && !GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) && !GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+}
 
-	if (!end_point->enabled && !p_allow_partial_path) {
+template <typename T>
+bool AStar3D::_solve(T *p_owner, SolveState &r_state, uint32_t p_begin_index, uint32_t p_end_index, bool p_allow_partial_path) {
+	r_state.last_closest_point = UINT32_MAX;
+	r_state.pass++;
+
+	if (!solve_enabled[p_end_index] && !p_allow_partial_path) {
 		return false;
 	}
 
-	bool found_route = false;
+	const uint64_t pass = r_state.pass;
+	SolvePoint *solve_state_points = r_state.points.ptr();
+	LocalVector<uint32_t> &open_list = r_state.open_list;
+	open_list.clear();
+
+	// Returns true when the point A is worse than point B.
+	// If the f_costs are the same then prioritize the points that are further away from the start.
+	auto is_worse = [solve_state_points](uint32_t p_a, uint32_t p_b) -> bool {
+		const SolvePoint &a = solve_state_points[p_a];
+		const SolvePoint &b = solve_state_points[p_b];
+		if (a.f_score != b.f_score) {
+			return a.f_score > b.f_score;
+		}
+		return a.g_score < b.g_score;
+	};
+
+	auto shift_up = [&](uint32_t p_open_list_index) {
+		const uint32_t point = open_list[p_open_list_index];
+		while (p_open_list_index > 0) {
+			const uint32_t parent_index = (p_open_list_index - 1) / 2;
+			if (!is_worse(open_list[parent_index], point)) {
+				break;
+			}
+			open_list[p_open_list_index] = open_list[parent_index];
+			solve_state_points[open_list[p_open_list_index]].open_list_index = p_open_list_index;
+			p_open_list_index = parent_index;
+		}
+		open_list[p_open_list_index] = point;
+		solve_state_points[point].open_list_index = p_open_list_index;
+	};
+
+	auto pop_front = [&]() {
+		const uint32_t last = open_list[open_list.size() - 1];
+		open_list.remove_at(open_list.size() - 1);
+		if (open_list.is_empty()) {
+			return;
+		}
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+		uint32_t open_list_index = 0;
+		const uint32_t open_list_size = open_list.size();
+		while (true) {
+			uint32_t child_index = 2 * open_list_index + 1;
+			if (child_index >= open_list_size) {
+				break;
+			}
+			if (child_index + 1 < open_list_size && is_worse(open_list[child_index], open_list[child_index + 1])) {
+				child_index++;
+			}
+			if (!is_worse(last, open_list[child_index])) {
+				break;
+			}
+			open_list[open_list_index] = open_list[child_index];
+			solve_state_points[open_list[open_list_index]].open_list_index = open_list_index;
+			open_list_index = child_index;
+		}
+		open_list[open_list_index] = last;
+		solve_state_points[last].open_list_index = open_list_index;
+	};
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	bool found_route = false;
+	const int64_t end_id = solve_ids[p_end_index];
+	const bool default_costs = p_owner->_has_default_costs();
+	const Vector3 *positions = solve_positions.ptr();
+	const Vector3 &end_position = positions[p_end_index];
+
+	SolvePoint &begin_point = solve_state_points[p_begin_index];
+	begin_point.g_score = 0;
+	begin_point.f_score = default_costs ? positions[p_begin_index].distance_to(end_position) : p_owner->_estimate_cost(solve_ids[p_begin_index], end_id);
+	begin_point.open_pass = pass;
+	open_list.push_back(p_begin_index);
+	begin_point.open_list_index = 0;
 
 	while (!open_list.is_empty()) {
-		Point *p = open_list[0]; // The currently processed point.
+		const uint32_t p_index = open_list[0]; // The currently processed point.
+		SolvePoint &p = solve_state_points[p_index];
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+		// The distance to the end point is the f_score without the g_score.
+		if (r_state.last_closest_point == UINT32_MAX) {
+			r_state.last_closest_point = p_index;
+		} else {
+			const SolvePoint &closest = solve_state_points[r_state.last_closest_point];
+			const real_t closest_h_score = closest.f_score - closest.g_score;
+			const real_t h_score = p.f_score - p.g_score;
+			if (closest_h_score > h_score || (closest_h_score >= h_score && closest.g_score > p.g_score)) {
+				r_state.last_closest_point = p_index;
+			}
 		}
 
-		if (p == end_point) {
+		if (p_index == p_end_index) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		pop_front(); // Remove the current point from the open list.
+		p.closed_pass = pass; // Mark the point as closed.
 
-		for (const KeyValue<int64_t, Point *> &kv : p->neighbors) {
-			Point *e = kv.value; // The neighbor point.
+		const int64_t p_id = solve_ids[p_index];
+		for (uint32_t i = solve_neighbor_offsets[p_index]; i < solve_neighbor_offsets[p_index + 1]; i++) {
+			const uint32_t e_index = solve_neighbors[i]; // The neighbor point.
+			SolvePoint &e = solve_state_points[e_index];
 
-			if (!e->enabled || e->closed_pass == pass) {
+			if (!solve_enabled[e_index] || e.closed_pass == pass) {
 				continue;
 			}
 
-			if (neighbor_filter_enabled) {
-				bool filtered;
-				if (GDVIRTUAL_CALL(_filter_neighbor, p->id, e->id, filtered) && filtered) {
-					continue;
-				}
+			const int64_t e_id = solve_ids[e_index];
+			if (neighbor_filter_enabled && p_owner->_filter_neighbor(p_id, e_id)) {
+				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			const real_t cost = default_costs ? positions[p_index].distance_to(positions[e_index]) : p_owner->_compute_cost(p_id, e_id);
+			real_t tentative_g_score = p.g_score + cost * solve_weight_scales[e_index];
 
 			bool new_point = false;
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
-				open_list.push_back(e);
+			if (e.open_pass != pass) { // The point wasn't inside the open list.
+				e.open_pass = pass;
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= e.g_score) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			e.prev_point = p_index;
+			e.g_score = tentative_g_score;
+			e.f_score = e.g_score + (default_costs ? positions[e_index].distance_to(end_position) : p_owner->_estimate_cost(e_id, end_id));
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+			if (new_point) {
+				open_list.push_back(e_index);
+				shift_up(open_list.size() - 1);
+			} else { // The position of the point in the open list is already known.
+				shift_up(e.open_list_index);
 			}
 		}
 	}
@@ -385,6 +559,120 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_
 	return found_route;
 }
 
+template <typename T>
+bool AStar3D::_find_path(T *p_owner, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path, LocalVector<uint32_t> &r_path) {
+	_update_solve_graph();
+
+	const uint32_t begin_index = p_begin_point->solve_index;
+	uint32_t end_index = p_end_point->solve_index;
+
+	SolveState *state = _acquire_solve_state();
+	bool found_route = _solve(p_owner, *state, begin_index, end_index, p_allow_partial_path);
+	if (!found_route) {
+		if (!p_allow_partial_path || state->last_closest_point == UINT32_MAX) {
+			_release_solve_state(state);
+			return false;
+		}
+
+		// Use closest point instead.
+		end_index = state->last_closest_point;
+	}
+
+	r_path.clear();
+	uint32_t index = end_index;
+	while (index != begin_index) {
+		r_path.push_back(index);
+		index = state->points[index].prev_point;
+	}
+	r_path.push_back(begin_index);
+	r_path.invert();
+
+	_release_solve_state(state);
+	return true;
+}
+
+template <typename T>
+Vector<int64_t> AStar3D::_get_id_path(T *p_owner, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
+	if (p_begin_point == p_end_point) {
+		Vector<int64_t> ret;
+		ret.push_back(p_begin_point->id);
+		return ret;
+	}
+
+	if (!p_begin_point->enabled) {
+		return Vector<int64_t>();
+	}
+
+	LocalVector<uint32_t> path_indices;
+	if (!_find_path(p_owner, p_begin_point, p_end_point, p_allow_partial_path, path_indices)) {
+		return Vector<int64_t>();
+	}
+
+	Vector<int64_t> path;
+	path.resize(path_indices.size());
+	int64_t *w = path.ptrw();
+	for (uint32_t i = 0; i < path_indices.size(); i++) {
+		w[i] = solve_ids[path_indices[i]];
+	}
+
+	return path;
+}
+
+template <typename T>
+void AStar3D::_get_id_path_batch_task(uint32_t p_index, IdPathBatch<T> *p_batch) {
+	Point *begin_point = p_batch->begin_points[p_index];
+	Point *end_point = p_batch->end_points[p_index];
+	if (begin_point && end_point) {
+		p_batch->paths[p_index] = _get_id_path(p_batch->owner, begin_point, end_point, p_batch->allow_partial_path);
+	}
+}
+
+template <typename T>
+TypedArray<PackedInt64Array> AStar3D::_get_id_paths(T *p_owner, const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path) {
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), TypedArray<PackedInt64Array>(), vformat("Can't get id paths. The from and to id arrays have different sizes: %d and %d.", p_from_ids.size(), p_to_ids.size()));
+
+	const uint32_t path_count = p_from_ids.size();
+
+	IdPathBatch<T> batch;
+	batch.owner = p_owner;
+	batch.allow_partial_path = p_allow_partial_path;
+	batch.begin_points.resize(path_count);
+	batch.end_points.resize(path_count);
+	batch.paths.resize(path_count);
+
+	for (uint32_t i = 0; i < path_count; i++) {
+		Point **a_entry = points.getptr(p_from_ids[i]);
+		Point **b_entry = points.getptr(p_to_ids[i]);
+		batch.begin_points[i] = a_entry ? *a_entry : nullptr;
+		batch.end_points[i] = b_entry ? *b_entry : nullptr;
+		if (!a_entry) {
+			ERR_PRINT(vformat("Can't get id path. Point with id: %d doesn't exist.", p_from_ids[i]));
+		} else if (!b_entry) {
+			ERR_PRINT(vformat("Can't get id path. Point with id: %d doesn't exist.", p_to_ids[i]));
+		}
+	}
+
+	// Build the solve graph once here instead of racing for it in the tasks.
+	_update_solve_graph();
+
+	if (path_count > 1 && p_owner->_is_solve_thread_safe()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStar3D::_get_id_path_batch_task<T>, &batch, path_count, -1, true, SNAME("AStarGetIdPaths"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < path_count; i++) {
+			_get_id_path_batch_task(i, &batch);
+		}
+	}
+
+	TypedArray<PackedInt64Array> paths;
+	paths.resize(path_count);
+	for (uint32_t i = 0; i < path_count; i++) {
+		paths[i] = batch.paths[i];
+	}
+
+	return paths;
+}
+
 real_t AStar3D::_estimate_cost(int64_t p_from_id, int64_t p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -434,40 +722,19 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<Vector3>();
-		}
-
-		// Use closest point instead.
-		end_point = last_closest_point;
-	}
-
-	Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+	LocalVector<uint32_t> path_indices;
+	if (!_find_path(this, a, b, p_allow_partial_path, path_indices)) {
+		return Vector<Vector3>();
 	}
 
 	Vector<Vector3> path;
-	path.resize(pc);
+	path.resize(path_indices.size());
 
 	{
 		Vector3 *w = path.ptrw();
-
-		Point *p2 = end_point;
-		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = p2->pos;
-			p2 = p2->prev_point;
+		for (uint32_t i = 0; i < path_indices.size(); i++) {
+			w[i] = solve_points[path_indices[i]]->pos;
 		}
-
-		w[0] = p2->pos; // Assign first
 	}
 
 	return path;
@@ -482,53 +749,11 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 	ERR_FAIL_COND_V_MSG(!b_entry, Vector<int64_t>(), vformat("Can't get id path. Point with id: %d doesn't exist.", p_to_id));
 	Point *b = *b_entry;
 
-	if (a == b) {
-		Vector<int64_t> ret;
-		ret.push_back(a->id);
-		return ret;
-	}
-
-	if (!a->enabled) {
-		return Vector<int64_t>();
-	}
-
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<int64_t>();
-		}
-
-		// Use closest point instead.
-		end_point = last_closest_point;
-	}
-
-	Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
-
-	Vector<int64_t> path;
-	path.resize(pc);
-
-	{
-		int64_t *w = path.ptrw();
-
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
-		}
-
-		w[0] = p->id; // Assign first
-	}
+	return _get_id_path(this, a, b, p_allow_partial_path);
+}
 
-	return path;
+TypedArray<PackedInt64Array> AStar3D::get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path) {
+	return _get_id_paths(this, p_from_ids, p_to_ids, p_allow_partial_path);
 }
 
 bool AStar3D::is_neighbor_filter_enabled() const {
@@ -545,6 +770,9 @@ void AStar3D::set_point_disabled(int64_t p_id, bool p_disabled) {
 	Point *p = *p_entry;
 
 	p->enabled = !p_disabled;
+	if (!solve_graph_dirty.is_set()) {
+		solve_enabled[p->solve_index] = p->enabled;
+	}
 }
 
 bool AStar3D::is_point_disabled(int64_t p_id) const {
@@ -587,6 +815,7 @@ void AStar3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStar3D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStar3D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids", "allow_partial_path"), &AStar3D::get_id_paths, DEFVAL(false));
 
 	GDVIRTUAL_BIND(_filter_neighbor, "from_id", "neighbor_id")
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
@@ -597,6 +826,9 @@ void AStar3D::_bind_methods() {
 
 AStar3D::~AStar3D() {
 	clear();
+	for (SolveState *state : solve_states) {
+		memdelete(state);
+	}
 }
 
 /////////////////////////////////////////////////////////////
@@ -743,40 +975,20 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
-			return Vector<Vector2>();
-		}
-
-		// Use closest point instead.
-		end_point = astar.last_closest_point;
-	}
-
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+	LocalVector<uint32_t> path_indices;
+	if (!astar._find_path(this, a, b, p_allow_partial_path, path_indices)) {
+		return Vector<Vector2>();
 	}
 
 	Vector<Vector2> path;
-	path.resize(pc);
+	path.resize(path_indices.size());
 
 	{
 		Vector2 *w = path.ptrw();
-
-		AStar3D::Point *p2 = end_point;
-		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = Vector2(p2->pos.x, p2->pos.y);
-			p2 = p2->prev_point;
+		for (uint32_t i = 0; i < path_indices.size(); i++) {
+			const Vector3 &pos = astar.solve_points[path_indices[i]]->pos;
+			w[i] = Vector2(pos.x, pos.y);
 		}
-
-		w[0] = Vector2(p2->pos.x, p2->pos.y); // Assign first
 	}
 
 	return path;
@@ -791,132 +1003,25 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 	ERR_FAIL_COND_V_MSG(!to_entry, Vector<int64_t>(), vformat("Can't get id path. Point with id: %d doesn't exist.", p_to_id));
 	AStar3D::Point *b = *to_entry;
 
-	if (a == b) {
-		Vector<int64_t> ret;
-		ret.push_back(a->id);
-		return ret;
-	}
-
-	if (!a->enabled) {
-		return Vector<int64_t>();
-	}
-
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
-			return Vector<int64_t>();
-		}
-
-		// Use closest point instead.
-		end_point = astar.last_closest_point;
-	}
-
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
-
-	Vector<int64_t> path;
-	path.resize(pc);
-
-	{
-		int64_t *w = path.ptrw();
-
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
-		}
-
-		w[0] = p->id; // Assign first
-	}
-
-	return path;
+	return astar._get_id_path(this, a, b, p_allow_partial_path);
 }
 
-bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path) {
-	astar.last_closest_point = nullptr;
-	astar.pass++;
-
-	if (!end_point->enabled && !p_allow_partial_path) {
-		return false;
-	}
-
-	bool found_route = false;
-
-	LocalVector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
-
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
-
-	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point.
-
-		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (astar.last_closest_point == nullptr || astar.last_closest_point->abs_f_score > p->abs_f_score || (astar.last_closest_point->abs_f_score >= p->abs_f_score && astar.last_closest_point->abs_g_score > p->abs_g_score)) {
-			astar.last_closest_point = p;
-		}
-
-		if (p == end_point) {
-			found_route = true;
-			break;
-		}
-
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = astar.pass; // Mark the point as closed.
-
-		for (KeyValue<int64_t, AStar3D::Point *> &kv : p->neighbors) {
-			AStar3D::Point *e = kv.value; // The neighbor point.
-
-			if (!e->enabled || e->closed_pass == astar.pass) {
-				continue;
-			}
-
-			if (astar.neighbor_filter_enabled) {
-				bool filtered;
-				if (GDVIRTUAL_CALL(_filter_neighbor, p->id, e->id, filtered) && filtered) {
-					continue;
-				}
-			}
-
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
-
-			bool new_point = false;
-
-			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
-				e->open_pass = astar.pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
-				continue;
-			}
+TypedArray<PackedInt64Array> AStar2D::get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path) {
+	return astar._get_id_paths(this, p_from_ids, p_to_ids, p_allow_partial_path);
+}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+bool AStar2D::_filter_neighbor(int64_t p_from_id, int64_t p_neighbor_id) {
+	bool filtered;
+	return GDVIRTUAL_CALL(_filter_neighbor, p_from_id, p_neighbor_id, filtered) && filtered;
+}
 
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
-		}
-	}
+bool AStar2D::_is_solve_thread_safe() const {
+	// Script callbacks must not be called from worker threads.
+	return !astar.neighbor_filter_enabled && !GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) && !GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+}
 
-	return found_route;
+bool AStar2D::_has_default_costs() const {
+	return typeid(*this) == typeid(AStar2D) && !GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) && !GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
 }
 
 void AStar2D::_bind_methods() {
@@ -951,6 +1056,7 @@ void AStar2D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStar2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStar2D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids", "allow_partial_path"), &AStar2D::get_id_paths, DEFVAL(false));
 
 	GDVIRTUAL_BIND(_filter_neighbor, "from_id", "neighbor_id")
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
@@ -32,7 +32,10 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
 #include "core/templates/a_hash_map.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/typed_array.h"
 
 /**
 	A* pathfinding algorithm.
@@ -51,28 +54,30 @@ class AStar3D : public RefCounted {
 		AHashMap<int64_t, Point *> neighbors = 4u;
 		AHashMap<int64_t, Point *> unlinked_neighbours = 4u;
 
-		// Used for pathfinding.
-		Point *prev_point = nullptr;
+		// Index in the solve graph, only valid while it is up to date.
+		uint32_t solve_index = 0;
+	};
+
+	// Per point pathfinding state, indexed like the solve graph.
+	struct SolvePoint {
+		uint32_t prev_point = UINT32_MAX;
+		uint32_t open_list_index = UINT32_MAX;
 		real_t g_score = 0;
 		real_t f_score = 0;
 		uint64_t open_pass = 0;
 		uint64_t closed_pass = 0;
-
-		// Used for getting closest_point_of_last_pathing_call.
-		real_t abs_g_score = 0;
-		real_t abs_f_score = 0;
 	};
 
-	struct SortPoints {
-		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
-				return true;
-			} else if (A->f_score < B->f_score) {
-				return false;
-			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
-			}
-		}
+	// Everything a single solve writes to, so several solves can run at the same time.
+	// The passes make sure stale values from previous solves are never read, so nothing needs to be reset between solves.
+	struct SolveState {
+		LocalVector<SolvePoint> points;
+		LocalVector<uint32_t> open_list;
+		uint64_t pass = 0;
+		uint64_t graph_version = 0;
+
+		// Used for getting closest_point_of_last_pathing_call.
+		uint32_t last_closest_point = UINT32_MAX;
 	};
 
 	struct Segment {
@@ -106,14 +111,54 @@ class AStar3D : public RefCounted {
 	};
 
 	mutable int64_t last_free_id = 0;
-	uint64_t pass = 1;
 
 	AHashMap<int64_t, Point *> points;
 	HashSet<Segment, Segment> segments;
-	Point *last_closest_point = nullptr;
 	bool neighbor_filter_enabled = false;
 
-	bool _solve(Point *begin_point, Point *end_point, bool p_allow_partial_path);
+	// Compact copy of the graph used for solving, rebuilt on the first solve after the connections changed.
+	// The neighbors of the point with index i are solve_neighbors[solve_neighbor_offsets[i]] to solve_neighbors[solve_neighbor_offsets[i + 1] - 1].
+	LocalVector<Point *> solve_points;
+	LocalVector<int64_t> solve_ids;
+	LocalVector<Vector3> solve_positions;
+	LocalVector<real_t> solve_weight_scales;
+	LocalVector<uint8_t> solve_enabled;
+	LocalVector<uint32_t> solve_neighbor_offsets;
+	LocalVector<uint32_t> solve_neighbors;
+	uint64_t solve_graph_version = 0;
+	SafeFlag solve_graph_dirty;
+	Mutex solve_graph_mutex;
+
+	LocalVector<SolveState *> solve_states;
+	Mutex solve_states_mutex;
+
+	template <typename T>
+	struct IdPathBatch {
+		T *owner = nullptr;
+		LocalVector<Point *> begin_points;
+		LocalVector<Point *> end_points;
+		LocalVector<Vector<int64_t>> paths;
+		bool allow_partial_path = false;
+	};
+
+	void _update_solve_graph();
+	SolveState *_acquire_solve_state();
+	void _release_solve_state(SolveState *p_state);
+
+	template <typename T>
+	bool _solve(T *p_owner, SolveState &r_state, uint32_t p_begin_index, uint32_t p_end_index, bool p_allow_partial_path);
+	template <typename T>
+	bool _find_path(T *p_owner, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path, LocalVector<uint32_t> &r_path);
+	template <typename T>
+	Vector<int64_t> _get_id_path(T *p_owner, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
+	template <typename T>
+	void _get_id_path_batch_task(uint32_t p_index, IdPathBatch<T> *p_batch);
+	template <typename T>
+	TypedArray<PackedInt64Array> _get_id_paths(T *p_owner, const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path);
+
+	bool _filter_neighbor(int64_t p_from_id, int64_t p_neighbor_id);
+	bool _is_solve_thread_safe() const;
+	bool _has_default_costs() const;
 
 protected:
 	static void _bind_methods();
@@ -164,15 +209,19 @@ public:
 
 	Vector<Vector3> get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
+	TypedArray<PackedInt64Array> get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path = false);
 
 	~AStar3D();
 };
 
 class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
+	friend class AStar3D;
 	AStar3D astar;
 
-	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path);
+	bool _filter_neighbor(int64_t p_from_id, int64_t p_neighbor_id);
+	bool _is_solve_thread_safe() const;
+	bool _has_default_costs() const;
 
 protected:
 	static void _bind_methods();
@@ -223,4 +272,5 @@ public:
 
 	Vector<Vector2> get_point_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
 	Vector<int64_t> get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_allow_partial_path = false);
+	TypedArray<PackedInt64Array> get_id_paths(const PackedInt64Array &p_from_ids, const PackedInt64Array &p_to_ids, bool p_allow_partial_path = false);
 };
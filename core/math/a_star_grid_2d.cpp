@@ -31,6 +31,7 @@
 #include "a_star_grid_2d.h"
 #include "a_star_grid_2d.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/typed_array.h"
 
 static real_t heuristic_euclidean(const Vector2i &p_from, const Vector2i &p_to) {
@@ -60,6 +61,28 @@ static real_t heuristic_chebyshev(const Vector2i &p_from, const Vector2i &p_to)
 
 static real_t (*heuristics[AStarGrid2D::HEURISTIC_MAX])(const Vector2i &, const Vector2i &) = { heuristic_euclidean, heuristic_manhattan, heuristic_octile, heuristic_chebyshev };
 
+// Top, right, bottom, left, then top-left, top-right, bottom-right, bottom-left, in the same order as _get_nbors().
+static const Vector2i flow_field_offsets[8] = {
+	Vector2i(0, -1), Vector2i(1, 0), Vector2i(0, 1), Vector2i(-1, 0),
+	Vector2i(-1, -1), Vector2i(1, -1), Vector2i(1, 1), Vector2i(-1, 1)
+};
+
+// Below this many cells, step costs are computed on the calling thread.
+static const uint32_t FLOW_FIELD_THREADING_THRESHOLD = 4096;
+
+static _FORCE_INLINE_ uint32_t flow_field_opposite(uint32_t p_direction) {
+	return (p_direction & 4) | ((p_direction + 2) & 3);
+}
+
+static uint32_t flow_field_direction(const Vector2i &p_offset) {
+	for (uint32_t i = 0; i < 8; i++) {
+		if (flow_field_offsets[i] == p_offset) {
+			return i;
+		}
+	}
+	return 0;
+}
+
 void AStarGrid2D::set_region(const Rect2i &p_region) {
 	ERR_FAIL_COND(p_region.size.x < 0 || p_region.size.y < 0);
 	if (p_region != region) {
@@ -165,6 +188,7 @@ void AStarGrid2D::update() {
 		solid_mask.push_back(true);
 	}
 
+	_clear_flow_field();
 	dirty = false;
 }
 
@@ -190,7 +214,10 @@ bool AStarGrid2D::is_jumping_enabled() const {
 
 void AStarGrid2D::set_diagonal_mode(DiagonalMode p_diagonal_mode) {
 	ERR_FAIL_INDEX((int)p_diagonal_mode, (int)DIAGONAL_MODE_MAX);
-	diagonal_mode = p_diagonal_mode;
+	if (diagonal_mode != p_diagonal_mode) {
+		diagonal_mode = p_diagonal_mode;
+		flow_field_dirty = true;
+	}
 }
 
 AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
@@ -199,7 +226,10 @@ AStarGrid2D::DiagonalMode AStarGrid2D::get_diagonal_mode() const {
 
 void AStarGrid2D::set_default_compute_heuristic(Heuristic p_heuristic) {
 	ERR_FAIL_INDEX((int)p_heuristic, (int)HEURISTIC_MAX);
-	default_compute_heuristic = p_heuristic;
+	if (default_compute_heuristic != p_heuristic) {
+		default_compute_heuristic = p_heuristic;
+		flow_field_dirty = true;
+	}
 }
 
 AStarGrid2D::Heuristic AStarGrid2D::get_default_compute_heuristic() const {
@@ -218,7 +248,10 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_estimate_heuristic() const {
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
-	_set_solid_unchecked(p_id, p_solid);
+	if (_get_solid_unchecked(p_id) != p_solid) {
+		_set_solid_unchecked(p_id, p_solid);
+		_flow_field_cell_changed(p_id.x, p_id.y);
+	}
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -231,7 +264,11 @@ void AStarGrid2D::set_point_weight_scale(const Vector2i &p_id, real_t p_weight_s
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set point's weight scale. Point %s out of bounds %s.", p_id, region));
 	ERR_FAIL_COND_MSG(p_weight_scale < 0.0, vformat("Can't set point's weight scale less than 0.0: %f.", p_weight_scale));
-	_get_point_unchecked(p_id)->weight_scale = p_weight_scale;
+	Point *p = _get_point_unchecked(p_id);
+	if (p->weight_scale != p_weight_scale) {
+		p->weight_scale = p_weight_scale;
+		_flow_field_cell_changed(p_id.x, p_id.y);
+	}
 }
 
 real_t AStarGrid2D::get_point_weight_scale(const Vector2i &p_id) const {
@@ -249,7 +286,10 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 
 	for (int32_t y = safe_region.position.y; y < end_y; y++) {
 		for (int32_t x = safe_region.position.x; x < end_x; x++) {
-			_set_solid_unchecked(x, y, p_solid);
+			if (_is_walkable(x, y) == p_solid) {
+				_set_solid_unchecked(x, y, p_solid);
+				_flow_field_cell_changed(x, y);
+			}
 		}
 	}
 }
@@ -264,7 +304,11 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 
 	for (int32_t y = safe_region.position.y; y < end_y; y++) {
 		for (int32_t x = safe_region.position.x; x < end_x; x++) {
-			_get_point_unchecked(x, y)->weight_scale = p_weight_scale;
+			Point *p = _get_point_unchecked(x, y);
+			if (p->weight_scale != p_weight_scale) {
+				p->weight_scale = p_weight_scale;
+				_flow_field_cell_changed(x, y);
+			}
 		}
 	}
 }
@@ -596,6 +640,7 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 void AStarGrid2D::clear() {
 	points.clear();
 	region = Rect2i();
+	_clear_flow_field();
 }
 
 Vector2 AStarGrid2D::get_point_position(const Vector2i &p_id) const {
@@ -735,6 +780,390 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	return path;
 }
 
+void AStarGrid2D::_clear_flow_field() {
+	flow_field_step_costs.clear();
+	flow_field_costs.clear();
+	flow_field_next.clear();
+	flow_field_flags.clear();
+	flow_field_changed.clear();
+	flow_field_dirty = true;
+}
+
+void AStarGrid2D::_flow_field_cell_changed(int32_t p_x, int32_t p_y) {
+	if (flow_field_dirty) {
+		return;
+	}
+
+	const uint32_t cell = _to_cell_index(p_x, p_y);
+	if (flow_field_flags[cell] & FLOW_FIELD_FLAG_CHANGED) {
+		return;
+	}
+
+	if (flow_field_changed.size() >= flow_field_flags.size() / 8) {
+		// Large edits are cheaper to redo from scratch.
+		flow_field_dirty = true;
+		return;
+	}
+
+	flow_field_flags[cell] |= FLOW_FIELD_FLAG_CHANGED;
+	flow_field_changed.push_back(cell);
+}
+
+bool AStarGrid2D::_is_flow_field_thread_safe() const {
+	// Script callbacks must not be called from worker threads.
+	return !GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+}
+
+void AStarGrid2D::_compute_flow_field_step_costs(uint32_t p_cell) {
+	const Vector2i from_id(region.position.x + int32_t(p_cell % region.size.x), region.position.y + int32_t(p_cell / region.size.x));
+	real_t *step_costs = &flow_field_step_costs[p_cell * 8];
+
+	if (!_is_walkable(from_id.x, from_id.y)) {
+		for (uint32_t i = 0; i < 8; i++) {
+			step_costs[i] = Math::INF;
+		}
+		return;
+	}
+
+	// The solid border of the mask keeps lookups just outside the region valid.
+	const bool sides[4] = {
+		_is_walkable(from_id.x, from_id.y - 1),
+		_is_walkable(from_id.x + 1, from_id.y),
+		_is_walkable(from_id.x, from_id.y + 1),
+		_is_walkable(from_id.x - 1, from_id.y),
+	};
+
+	for (uint32_t i = 0; i < 8; i++) {
+		const Vector2i to_id = from_id + flow_field_offsets[i];
+		bool allowed = i < 4 ? sides[i] : _is_walkable(to_id.x, to_id.y);
+
+		if (allowed && i >= 4) {
+			// The two sides touched by the diagonal step.
+			const bool side_a = sides[i - 4];
+			const bool side_b = sides[(i - 1) % 4];
+
+			switch (diagonal_mode) {
+				case DIAGONAL_MODE_NEVER: {
+					allowed = false;
+				} break;
+				case DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE: {
+					allowed = side_a || side_b;
+				} break;
+				case DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES: {
+					allowed = side_a && side_b;
+				} break;
+				default:
+					break;
+			}
+		}
+
+		step_costs[i] = allowed ? _compute_cost(from_id, to_id) * _get_point_unchecked(to_id)->weight_scale : (real_t)Math::INF;
+	}
+}
+
+void AStarGrid2D::_flow_field_step_costs_row_task(uint32_t p_row, void *p_userdata) {
+	const uint32_t width = region.size.x;
+	for (uint32_t i = p_row * width; i < (p_row + 1) * width; i++) {
+		_compute_flow_field_step_costs(i);
+	}
+}
+
+void AStarGrid2D::_flow_field_step_costs_cell_task(uint32_t p_index, const uint32_t *p_cells) {
+	_compute_flow_field_step_costs(p_cells[p_index]);
+}
+
+void AStarGrid2D::_seed_flow_field_cell(uint32_t p_cell, LocalVector<FlowFieldNode> &r_open_list) {
+	const uint32_t width = region.size.x;
+	const uint32_t height = region.size.y;
+	const Vector2i cell_pos(p_cell % width, p_cell / width);
+
+	real_t best_cost = flow_field_costs[p_cell];
+	int32_t best_next = -1;
+
+	if (flow_field_flags[p_cell] & FLOW_FIELD_FLAG_GOAL) {
+		if (!_is_walkable(region.position.x + cell_pos.x, region.position.y + cell_pos.y) || best_cost == 0) {
+			return;
+		}
+		best_cost = 0;
+	} else {
+		// Take the cheapest step onto a neighbor that already has a route.
+		for (uint32_t i = 0; i < 8; i++) {
+			const Vector2i nbor_pos = cell_pos + flow_field_offsets[i];
+			if (nbor_pos.x < 0 || nbor_pos.y < 0 || nbor_pos.x >= (int32_t)width || nbor_pos.y >= (int32_t)height) {
+				continue;
+			}
+
+			const uint32_t nbor = nbor_pos.y * width + nbor_pos.x;
+			const real_t cost = flow_field_costs[nbor] + flow_field_step_costs[p_cell * 8 + i];
+			if (cost < best_cost) {
+				best_cost = cost;
+				best_next = nbor;
+			}
+		}
+
+		if (best_next == -1) {
+			return;
+		}
+	}
+
+	flow_field_costs[p_cell] = best_cost;
+	flow_field_next[p_cell] = best_next;
+
+	SortArray<FlowFieldNode, SortFlowFieldNodes> sorter;
+	r_open_list.push_back({ best_cost, p_cell });
+	sorter.push_heap(0, r_open_list.size() - 1, 0, r_open_list[r_open_list.size() - 1], r_open_list.ptr());
+}
+
+void AStarGrid2D::_propagate_flow_field(LocalVector<FlowFieldNode> &r_open_list) {
+	const uint32_t width = region.size.x;
+	const uint32_t height = region.size.y;
+	SortArray<FlowFieldNode, SortFlowFieldNodes> sorter;
+
+	// Dijkstra outward from the queued cells, following steps backwards.
+	while (!r_open_list.is_empty()) {
+		const FlowFieldNode node = r_open_list[0];
+		sorter.pop_heap(0, r_open_list.size(), r_open_list.ptr());
+		r_open_list.remove_at(r_open_list.size() - 1);
+
+		if (node.cost > flow_field_costs[node.cell]) {
+			continue; // A cheaper route reached this cell after it was queued.
+		}
+
+		const Vector2i cell_pos(node.cell % width, node.cell / width);
+		for (uint32_t i = 0; i < 8; i++) {
+			const Vector2i nbor_pos = cell_pos + flow_field_offsets[i];
+			if (nbor_pos.x < 0 || nbor_pos.y < 0 || nbor_pos.x >= (int32_t)width || nbor_pos.y >= (int32_t)height) {
+				continue;
+			}
+
+			// Units on the neighbor step back onto this cell.
+			const uint32_t nbor = nbor_pos.y * width + nbor_pos.x;
+			const real_t cost = node.cost + flow_field_step_costs[nbor * 8 + flow_field_opposite(i)];
+			if (cost < flow_field_costs[nbor]) {
+				flow_field_costs[nbor] = cost;
+				flow_field_next[nbor] = node.cell;
+				r_open_list.push_back({ cost, nbor });
+				sorter.push_heap(0, r_open_list.size() - 1, 0, r_open_list[r_open_list.size() - 1], r_open_list.ptr());
+			}
+		}
+	}
+}
+
+void AStarGrid2D::_rebuild_flow_field() {
+	const uint32_t cell_count = region.size.x * region.size.y;
+
+	flow_field_step_costs.resize(cell_count * 8);
+	flow_field_costs.resize(cell_count);
+	flow_field_next.resize(cell_count);
+	flow_field_flags.resize(cell_count);
+	flow_field_changed.clear();
+
+	for (uint32_t i = 0; i < cell_count; i++) {
+		flow_field_costs[i] = Math::INF;
+		flow_field_next[i] = -1;
+		flow_field_flags[i] = 0;
+	}
+
+	if (cell_count >= FLOW_FIELD_THREADING_THRESHOLD && _is_flow_field_thread_safe()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStarGrid2D::_flow_field_step_costs_row_task, (void *)nullptr, region.size.y, -1, true, SNAME("AStarGrid2DFlowField"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < cell_count; i++) {
+			_compute_flow_field_step_costs(i);
+		}
+	}
+
+	LocalVector<FlowFieldNode> open_list;
+	for (const Vector2i &goal : flow_field_goals) {
+		ERR_CONTINUE_MSG(!is_in_boundsv(goal), vformat("Can't use flow field goal. Point %s out of bounds %s.", goal, region));
+		const uint32_t cell = _to_cell_index(goal.x, goal.y);
+		flow_field_flags[cell] |= FLOW_FIELD_FLAG_GOAL;
+		_seed_flow_field_cell(cell, open_list);
+	}
+
+	_propagate_flow_field(open_list);
+	flow_field_dirty = false;
+}
+
+void AStarGrid2D::_update_flow_field_cells() {
+	const uint32_t width = region.size.x;
+	const uint32_t height = region.size.y;
+	const uint32_t cell_count = width * height;
+
+	// A changed cell alters its own steps, the steps onto it, and the diagonal steps around it.
+	LocalVector<uint32_t> affected;
+	for (const uint32_t cell : flow_field_changed) {
+		const int32_t cell_x = cell % width;
+		const int32_t cell_y = cell / width;
+		for (int32_t y = MAX(cell_y - 1, 0); y <= MIN(cell_y + 1, (int32_t)height - 1); y++) {
+			for (int32_t x = MAX(cell_x - 1, 0); x <= MIN(cell_x + 1, (int32_t)width - 1); x++) {
+				const uint32_t nbor = y * width + x;
+				if (!(flow_field_flags[nbor] & FLOW_FIELD_FLAG_AFFECTED)) {
+					flow_field_flags[nbor] |= FLOW_FIELD_FLAG_AFFECTED;
+					affected.push_back(nbor);
+				}
+			}
+		}
+	}
+	flow_field_changed.clear();
+
+	LocalVector<real_t> old_step_costs;
+	old_step_costs.resize(affected.size() * 8);
+	for (uint32_t i = 0; i < affected.size(); i++) {
+		memcpy(&old_step_costs[i * 8], &flow_field_step_costs[affected[i] * 8], sizeof(real_t) * 8);
+	}
+
+	if (affected.size() >= FLOW_FIELD_THREADING_THRESHOLD && _is_flow_field_thread_safe()) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStarGrid2D::_flow_field_step_costs_cell_task, (const uint32_t *)affected.ptr(), affected.size(), -1, true, SNAME("AStarGrid2DFlowField"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (const uint32_t cell : affected) {
+			_compute_flow_field_step_costs(cell);
+		}
+	}
+
+	// Routes whose first step changed are dropped. Routes that only gained cheaper steps are kept, and reseeded below.
+	LocalVector<uint32_t> invalid;
+	for (uint32_t i = 0; i < affected.size(); i++) {
+		const uint32_t cell = affected[i];
+		const int32_t next = flow_field_next[cell];
+
+		bool is_invalid;
+		if (next == -1) {
+			// Either a goal, which only loses its route by becoming solid, or a cell without a route.
+			is_invalid = flow_field_costs[cell] != Math::INF && !_is_walkable(region.position.x + cell % width, region.position.y + cell / width);
+		} else {
+			const uint32_t direction = flow_field_direction(Vector2i(next % width, next / width) - Vector2i(cell % width, cell / width));
+			is_invalid = flow_field_step_costs[cell * 8 + direction] != old_step_costs[i * 8 + direction];
+		}
+
+		if (is_invalid) {
+			flow_field_flags[cell] |= FLOW_FIELD_FLAG_INVALID;
+			invalid.push_back(cell);
+		}
+	}
+
+	const bool has_invalid = !invalid.is_empty();
+	if (has_invalid) {
+		// Every route passing through a dropped cell is dropped too. Each route is walked until a cell with a known state.
+		LocalVector<uint32_t> route;
+		for (uint32_t cell = 0; cell < cell_count; cell++) {
+			int32_t current = cell;
+			route.clear();
+			while (current != -1 && !(flow_field_flags[current] & (FLOW_FIELD_FLAG_INVALID | FLOW_FIELD_FLAG_RESOLVED))) {
+				route.push_back(current);
+				current = flow_field_next[current];
+			}
+
+			const bool route_invalid = current != -1 && (flow_field_flags[current] & FLOW_FIELD_FLAG_INVALID);
+			for (const uint32_t route_cell : route) {
+				flow_field_flags[route_cell] |= FLOW_FIELD_FLAG_RESOLVED;
+				if (route_invalid) {
+					flow_field_flags[route_cell] |= FLOW_FIELD_FLAG_INVALID;
+					invalid.push_back(route_cell);
+				}
+			}
+		}
+
+		for (const uint32_t cell : invalid) {
+			flow_field_costs[cell] = Math::INF;
+			flow_field_next[cell] = -1;
+		}
+	}
+
+	LocalVector<FlowFieldNode> open_list;
+	for (const uint32_t cell : invalid) {
+		_seed_flow_field_cell(cell, open_list);
+	}
+	for (const uint32_t cell : affected) {
+		_seed_flow_field_cell(cell, open_list);
+	}
+
+	_propagate_flow_field(open_list);
+
+	if (has_invalid) {
+		for (uint32_t i = 0; i < cell_count; i++) {
+			flow_field_flags[i] &= FLOW_FIELD_FLAG_GOAL;
+		}
+	} else {
+		for (const uint32_t cell : affected) {
+			flow_field_flags[cell] &= FLOW_FIELD_FLAG_GOAL;
+		}
+	}
+}
+
+void AStarGrid2D::set_flow_field_goals(const TypedArray<Vector2i> &p_goals) {
+	flow_field_goals.resize(p_goals.size());
+	for (int i = 0; i < p_goals.size(); i++) {
+		flow_field_goals[i] = p_goals[i];
+	}
+	flow_field_dirty = true;
+}
+
+TypedArray<Vector2i> AStarGrid2D::get_flow_field_goals() const {
+	TypedArray<Vector2i> goals;
+	goals.resize(flow_field_goals.size());
+	for (uint32_t i = 0; i < flow_field_goals.size(); i++) {
+		goals[i] = flow_field_goals[i];
+	}
+	return goals;
+}
+
+void AStarGrid2D::update_flow_field() {
+	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
+
+	if (flow_field_dirty) {
+		_rebuild_flow_field();
+	} else if (!flow_field_changed.is_empty()) {
+		_update_flow_field_cells();
+	}
+}
+
+PackedFloat32Array AStarGrid2D::get_flow_field_costs() const {
+	ERR_FAIL_COND_V_MSG(dirty, PackedFloat32Array(), "Grid is not initialized. Call the update method.");
+
+	PackedFloat32Array costs;
+	costs.resize(flow_field_costs.size());
+	float *w = costs.ptrw();
+	for (uint32_t i = 0; i < flow_field_costs.size(); i++) {
+		w[i] = flow_field_costs[i];
+	}
+	return costs;
+}
+
+PackedVector2Array AStarGrid2D::get_flow_field_directions() const {
+	ERR_FAIL_COND_V_MSG(dirty, PackedVector2Array(), "Grid is not initialized. Call the update method.");
+
+	const uint32_t width = region.size.x;
+	PackedVector2Array directions;
+	directions.resize(flow_field_next.size());
+	Vector2 *w = directions.ptrw();
+	for (uint32_t i = 0; i < flow_field_next.size(); i++) {
+		const int32_t next = flow_field_next[i];
+		w[i] = next == -1 ? Vector2() : Vector2(Vector2i(next % width, next / width) - Vector2i(i % width, i / width));
+	}
+	return directions;
+}
+
+real_t AStarGrid2D::get_flow_field_cost(const Vector2i &p_id) const {
+	ERR_FAIL_COND_V_MSG(dirty, Math::INF, "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), Math::INF, vformat("Can't get flow field cost. Point %s out of bounds %s.", p_id, region));
+	ERR_FAIL_COND_V_MSG(flow_field_costs.is_empty(), Math::INF, "Flow field is not initialized. Call the update_flow_field method.");
+	return flow_field_costs[_to_cell_index(p_id.x, p_id.y)];
+}
+
+Vector2i AStarGrid2D::get_flow_field_next_id(const Vector2i &p_id) const {
+	ERR_FAIL_COND_V_MSG(dirty, p_id, "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_id), p_id, vformat("Can't get flow field next id. Point %s out of bounds %s.", p_id, region));
+	ERR_FAIL_COND_V_MSG(flow_field_next.is_empty(), p_id, "Flow field is not initialized. Call the update_flow_field method.");
+
+	const int32_t next = flow_field_next[_to_cell_index(p_id.x, p_id.y)];
+	if (next == -1) {
+		return p_id;
+	}
+	return region.position + Vector2i(next % region.size.x, next / region.size.x);
+}
+
 void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_region", "region"), &AStarGrid2D::set_region);
 	ClassDB::bind_method(D_METHOD("get_region"), &AStarGrid2D::get_region);
@@ -771,6 +1200,14 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_id_path, DEFVAL(false));
 
+	ClassDB::bind_method(D_METHOD("set_flow_field_goals", "goals"), &AStarGrid2D::set_flow_field_goals);
+	ClassDB::bind_method(D_METHOD("get_flow_field_goals"), &AStarGrid2D::get_flow_field_goals);
+	ClassDB::bind_method(D_METHOD("update_flow_field"), &AStarGrid2D::update_flow_field);
+	ClassDB::bind_method(D_METHOD("get_flow_field_costs"), &AStarGrid2D::get_flow_field_costs);
+	ClassDB::bind_method(D_METHOD("get_flow_field_directions"), &AStarGrid2D::get_flow_field_directions);
+	ClassDB::bind_method(D_METHOD("get_flow_field_cost", "id"), &AStarGrid2D::get_flow_field_cost);
+	ClassDB::bind_method(D_METHOD("get_flow_field_next_id", "id"), &AStarGrid2D::get_flow_field_next_id);
+
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
 
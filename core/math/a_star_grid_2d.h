@@ -115,6 +115,34 @@ private:
 
 	uint64_t pass = 1;
 
+	struct FlowFieldNode {
+		real_t cost = 0;
+		uint32_t cell = 0;
+	};
+
+	struct SortFlowFieldNodes {
+		_FORCE_INLINE_ bool operator()(const FlowFieldNode &A, const FlowFieldNode &B) const { // Returns true when the node A is worse than node B.
+			return A.cost > B.cost;
+		}
+	};
+
+	enum {
+		FLOW_FIELD_FLAG_GOAL = 1,
+		FLOW_FIELD_FLAG_CHANGED = 2,
+		FLOW_FIELD_FLAG_AFFECTED = 4,
+		FLOW_FIELD_FLAG_INVALID = 8,
+		FLOW_FIELD_FLAG_RESOLVED = 16,
+	};
+
+	// Flow field data, stored row by row over the region.
+	LocalVector<Vector2i> flow_field_goals;
+	LocalVector<real_t> flow_field_step_costs; // Cost of stepping from each cell to its 8 neighbors.
+	LocalVector<real_t> flow_field_costs;
+	LocalVector<int32_t> flow_field_next;
+	LocalVector<uint8_t> flow_field_flags;
+	LocalVector<uint32_t> flow_field_changed;
+	bool flow_field_dirty = true;
+
 private: // Internal routines.
 	_FORCE_INLINE_ size_t _to_mask_index(int32_t p_x, int32_t p_y) const {
 		return ((p_y - region.position.y + 1) * (region.size.x + 2)) + p_x - region.position.x + 1;
@@ -124,6 +152,10 @@ private: // Internal routines.
 		return !solid_mask[_to_mask_index(p_x, p_y)];
 	}
 
+	_FORCE_INLINE_ uint32_t _to_cell_index(int32_t p_x, int32_t p_y) const {
+		return (p_y - region.position.y) * region.size.x + p_x - region.position.x;
+	}
+
 	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
 		if (region.has_point(Vector2i(p_x, p_y))) {
 			return &points[p_y - region.position.y][p_x - region.position.x];
@@ -160,6 +192,17 @@ private: // Internal routines.
 	bool _solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
 	Point *_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive = false);
 
+	void _clear_flow_field();
+	void _flow_field_cell_changed(int32_t p_x, int32_t p_y);
+	bool _is_flow_field_thread_safe() const;
+	void _compute_flow_field_step_costs(uint32_t p_cell);
+	void _flow_field_step_costs_row_task(uint32_t p_row, void *p_userdata);
+	void _flow_field_step_costs_cell_task(uint32_t p_index, const uint32_t *p_cells);
+	void _seed_flow_field_cell(uint32_t p_cell, LocalVector<FlowFieldNode> &r_open_list);
+	void _propagate_flow_field(LocalVector<FlowFieldNode> &r_open_list);
+	void _rebuild_flow_field();
+	void _update_flow_field_cells();
+
 protected:
 	static void _bind_methods();
 
@@ -224,6 +267,15 @@ public:
 	TypedArray<Dictionary> get_point_data_in_region(const Rect2i &p_region) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
+
+	void set_flow_field_goals(const TypedArray<Vector2i> &p_goals);
+	TypedArray<Vector2i> get_flow_field_goals() const;
+	void update_flow_field();
+
+	PackedFloat32Array get_flow_field_costs() const;
+	PackedVector2Array get_flow_field_directions() const;
+	real_t get_flow_field_cost(const Vector2i &p_id) const;
+	Vector2i get_flow_field_next_id(const Vector2i &p_id) const;
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
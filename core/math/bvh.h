@@ -313,6 +313,99 @@ public:
 		_check_for_collisions();
 	}
 
+	// Multithreaded alternative to update(). Call update_tree(), then split
+	// [0, get_changed_item_count()) into ranges of the same size and call gather_pair_candidates()
+	// on each range from any thread (it only reads the tree and sends no callbacks),
+	// then apply_pair_candidates() with the candidates of every range. That finds the leavers
+	// and sends the callbacks serially in changed item order, exactly as update()
+	// would, so the result doesn't depend on how the ranges were distributed among threads.
+	// The BVH must not be modified between update_tree() and apply_pair_candidates().
+	struct PairCandidate {
+		BVHHandle from; // The changed item.
+		BVHHandle to;
+	};
+
+	void update_tree() {
+		BVH_LOCKED_FUNCTION
+		tree.update();
+	}
+
+	uint32_t get_changed_item_count() const {
+		return changed_items.size();
+	}
+
+	void gather_pair_candidates(uint32_t p_from, uint32_t p_to, LocalVector<PairCandidate> &r_candidates) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+
+		LocalVector<uint32_t> hits;
+
+		for (uint32_t i = p_from; i < p_to; i++) {
+			const BVHHandle h = changed_items[i];
+
+			// use the expanded aabb for pairing
+			const BOUNDS &expanded_aabb = tree._pairs[h.id()].expanded_aabb;
+			BVHABB_CLASS abb;
+			abb.from(expanded_aabb);
+
+			tree.item_fill_cullparams(h, params);
+			params.abb = abb;
+
+			hits.clear();
+			tree.cull_aabb_hits(params, hits);
+
+			const typename BVHTREE_CLASS::ItemExtra &exa = _get_extra(h);
+			for (const uint32_t ref_id : hits) {
+				if (ref_id == h.id()) {
+					continue;
+				}
+
+				BVHHandle h_to;
+				h_to.set_id(ref_id);
+
+				// Existing pairs are kept, as earlier changed items may unpair them before
+				// this one is applied. Only the checks that can't change meanwhile are done here.
+				const typename BVHTREE_CLASS::ItemExtra &exb = _get_extra(h_to);
+				if (((exa.userdata == exb.userdata) && exa.userdata) || !USER_PAIR_TEST_FUNCTION::user_pair_check(exa.userdata, exb.userdata)) {
+					continue;
+				}
+
+				r_candidates.push_back({ h, h_to });
+			}
+		}
+	}
+
+	void apply_pair_candidates(const LocalVector<PairCandidate> *p_candidates, uint32_t p_range_size) {
+		BVH_LOCKED_FUNCTION
+		uint32_t candidate = 0;
+		for (uint32_t i = 0; i < changed_items.size(); i++) {
+			const LocalVector<PairCandidate> &candidates = p_candidates[i / p_range_size];
+			if (i % p_range_size == 0) {
+				candidate = 0;
+			}
+
+			const BVHHandle h = changed_items[i];
+			BVHABB_CLASS abb;
+			abb.from(tree._pairs[h.id()].expanded_aabb);
+
+			// Same as _check_for_collisions(), with the cull already done.
+			_find_leavers(h, abb, false);
+
+			while (candidate < candidates.size() && candidates[candidate].from == h) {
+				_collide(h, candidates[candidate].to);
+				candidate++;
+			}
+		}
+		_reset();
+#ifdef BVH_INTEGRITY_CHECKS
+		tree._integrity_check_all();
+#endif
+	}
+
 	// prefer calling this directly as type safe
 	void set_tree(const BVHHandle &p_handle, uint32_t p_tree_id, uint32_t p_tree_collision_mask, bool p_force_collision_check = true) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -590,40 +683,48 @@ private:
 		}
 	}
 
-	// find NEW enterers, and send callbacks for them only
-	// handle a and b
-	void _collide(BVHHandle p_ha, BVHHandle p_hb) {
-		// only have to do this oneway, lower ID then higher ID
-		tree._handle_sort(p_ha, p_hb);
-
+	// returns true if the handles (sorted) are allowed to pair and are not paired yet
+	bool _is_new_pair(BVHHandle p_ha, BVHHandle p_hb) const {
 		const typename BVHTREE_CLASS::ItemExtra &exa = _get_extra(p_ha);
 		const typename BVHTREE_CLASS::ItemExtra &exb = _get_extra(p_hb);
 
 		// user collision callback
 		if (!USER_PAIR_TEST_FUNCTION::user_pair_check(exa.userdata, exb.userdata)) {
-			return;
+			return false;
 		}
 
 		// if the userdata is the same, no collisions should occur
 		if ((exa.userdata == exb.userdata) && exa.userdata) {
-			return;
+			return false;
 		}
 
-		typename BVHTREE_CLASS::ItemPairs &p_from = tree._pairs[p_ha.id()];
-		typename BVHTREE_CLASS::ItemPairs &p_to = tree._pairs[p_hb.id()];
+		const typename BVHTREE_CLASS::ItemPairs &p_from = tree._pairs[p_ha.id()];
+		const typename BVHTREE_CLASS::ItemPairs &p_to = tree._pairs[p_hb.id()];
 
 		// does this pair exist already?
 		// or only check the one with lower number of pairs for greater speed
 		if (p_from.num_pairs <= p_to.num_pairs) {
-			if (p_from.contains_pair_to(p_hb)) {
-				return;
-			}
-		} else {
-			if (p_to.contains_pair_to(p_ha)) {
-				return;
-			}
+			return !p_from.contains_pair_to(p_hb);
+		}
+		return !p_to.contains_pair_to(p_ha);
+	}
+
+	// find NEW enterers, and send callbacks for them only
+	// handle a and b
+	void _collide(BVHHandle p_ha, BVHHandle p_hb) {
+		// only have to do this oneway, lower ID then higher ID
+		tree._handle_sort(p_ha, p_hb);
+
+		if (!_is_new_pair(p_ha, p_hb)) {
+			return;
 		}
 
+		const typename BVHTREE_CLASS::ItemExtra &exa = _get_extra(p_ha);
+		const typename BVHTREE_CLASS::ItemExtra &exb = _get_extra(p_hb);
+
+		typename BVHTREE_CLASS::ItemPairs &p_from = tree._pairs[p_ha.id()];
+		typename BVHTREE_CLASS::ItemPairs &p_to = tree._pairs[p_hb.id()];
+
 		// callback
 		void *callback_userdata = nullptr;
 
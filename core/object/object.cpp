@@ -1271,19 +1271,54 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+void Object::SignalData::invalidate_snapshot() {
+	if (snapshot) {
+		if (snapshot->refcount.unref()) {
+			memdelete(snapshot);
+		}
+		snapshot = nullptr;
+	}
+}
+
+Object::SignalData &Object::SignalData::operator=(const SignalData &p_from) {
+	invalidate_snapshot();
+	user = p_from.user;
+	slot_map = p_from.slot_map;
+	removable = p_from.removable;
+	return *this;
+}
+
+Object::SignalData::Snapshot *Object::_build_signal_snapshot(const SignalData &p_signal) {
+	SignalData::Snapshot *snapshot = memnew(SignalData::Snapshot);
+	snapshot->refcount.init();
+	snapshot->entries.resize(p_signal.slot_map.size());
+
+	uint32_t index = 0;
+	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : p_signal.slot_map) {
+		SignalData::Snapshot::Entry &entry = snapshot->entries[index++];
+		entry.callable = slot_kv.value.conn.callable;
+		entry.flags = slot_kv.value.conn.flags;
+		snapshot->has_one_shot = snapshot->has_one_shot || (entry.flags & CONNECT_ONE_SHOT);
+
+		// Methods bound in ClassDB can be called directly, as long as no script can override them.
+		// Extension method binds may go away on reload, so those keep going through Object::callp().
+		if (entry.callable.is_standard()) {
+			Object *target = entry.callable.get_object();
+			if (target && !target->_extension && entry.callable.get_method() != CoreStringName(free_)) {
+				entry.method = ClassDB::get_method(target->get_class_name(), entry.callable.get_method());
+			}
+		}
+	}
+
+	return snapshot;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
 
-	constexpr int MAX_SLOTS_ON_STACK = 5;
-	// Don't default initialize the Callable objects on the stack, just reserve the space - we'll memnew_placement() them later.
-	alignas(Callable) uint8_t slot_callable_stack[sizeof(Callable) * MAX_SLOTS_ON_STACK];
-	uint32_t slot_flags_stack[MAX_SLOTS_ON_STACK];
-
-	Callable *slot_callables = (Callable *)slot_callable_stack;
-	uint32_t *slot_flags = slot_flags_stack;
-	uint32_t slot_count = 0;
+	SignalData::Snapshot *snapshot = nullptr;
 
 	{
 		OBJ_SIGNAL_LOCK
@@ -1299,32 +1334,28 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			return ERR_UNAVAILABLE;
 		}
 
-		if (s->slot_map.size() > MAX_SLOTS_ON_STACK) {
-			slot_callables = (Callable *)memalloc(sizeof(Callable) * s->slot_map.size());
-			slot_flags = (uint32_t *)memalloc(sizeof(uint32_t) * s->slot_map.size());
+		if (!s->snapshot) {
+			s->snapshot = _build_signal_snapshot(*s);
 		}
 
 		// Ensure that disconnecting the signal or even deleting the object
 		// will not affect the signal calling.
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-			slot_flags[slot_count] = slot_kv.value.conn.flags;
-			++slot_count;
-		}
-
-		DEV_ASSERT(slot_count == s->slot_map.size());
+		snapshot = s->snapshot;
+		snapshot->refcount.ref();
 
 		// Disconnect all one-shot connections before emitting to prevent recursion.
-		for (uint32_t i = 0; i < slot_count; ++i) {
-			bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		if (snapshot->has_one_shot) {
+			for (const SignalData::Snapshot::Entry &entry : snapshot->entries) {
+				bool disconnect = entry.flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-			if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
-				// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
-				disconnect = false;
-			}
+				if (disconnect && (entry.flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+					// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
+					disconnect = false;
+				}
 #endif
-			if (disconnect) {
-				_disconnect(p_name, slot_callables[i]);
+				if (disconnect) {
+					_disconnect(p_name, entry.callable);
+				}
 			}
 		}
 	}
@@ -1340,11 +1371,22 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	Error err = OK;
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+	for (const SignalData::Snapshot::Entry &entry : snapshot->entries) {
+		const Callable &callable = entry.callable;
+		const uint32_t &flags = entry.flags;
 
-		if (!callable.is_valid()) {
+		Object *direct_target = nullptr;
+		if (entry.method) {
+			direct_target = ObjectDB::get_instance(callable.get_object_id());
+			if (!direct_target) {
+				// Target might have been deleted during signal callback, this is expected and OK.
+				continue;
+			}
+			if (direct_target->script_instance) {
+				// A script attached since the snapshot was built may override the method.
+				direct_target = nullptr;
+			}
+		} else if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
@@ -1358,7 +1400,14 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			Callable::CallError ce;
 			_emitting = true;
 			Variant ret;
-			callable.callp(args, argc, ret, ce);
+			if (direct_target) {
+#ifdef DEBUG_ENABLED
+				_ObjectDebugLock target_lock(direct_target);
+#endif
+				ret = entry.method->call(direct_target, args, argc, ce);
+			} else {
+				callable.callp(args, argc, ret, ce);
+			}
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
@@ -1378,13 +1427,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
-	if (slot_callables != (Callable *)slot_callable_stack) {
-		memfree(slot_callables);
-		memfree(slot_flags);
+	if (snapshot->refcount.unref()) {
+		memdelete(snapshot);
 	}
 
 	if (pending_unref) {
@@ -1637,6 +1681,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->invalidate_snapshot();
 
 	return OK;
 }
@@ -1717,6 +1762,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->invalidate_snapshot();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2452,14 +2498,29 @@ void postinitialize_handler(Object *p_object) {
 }
 
 void ObjectDB::debug_objects(DebugFunc p_func, void *p_user_data) {
+	// This keeps new chunks from being allocated while iterating. Other threads
+	// may still add instances through their own slot caches, but removing them
+	// waits for the lock, so the callback never sees an instance being freed.
 	spin_lock.lock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object, p_user_data);
-			count--;
+	debug_iterating.store(true, std::memory_order_seq_cst);
+	for (const ThreadCache *E = thread_caches; E; E = E->next) {
+		while (E->removing.load(std::memory_order_seq_cst)) {
+			// Wait for the removal that started before the flag was set.
 		}
 	}
+
+	for (uint32_t i = 0; i < slot_max; i++) {
+		ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.validator.load(std::memory_order_acquire)) {
+			Object *object = object_slot.object.load(std::memory_order_acquire);
+			if (object) {
+				p_func(object, p_user_data);
+			}
+		}
+	}
+
+	debug_iterating.store(false, std::memory_order_release);
 	spin_lock.unlock();
 }
 
@@ -2510,45 +2571,155 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 #endif
 
 SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::chunks[OBJECTDB_CHUNK_MAX_COUNT] = {};
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+LocalVector<uint32_t> ObjectDB::free_slots;
+SafeNumeric<uint64_t> ObjectDB::validator_counter;
+ObjectDB::ThreadCache *ObjectDB::thread_caches = nullptr;
+int64_t ObjectDB::retired_live = 0;
+uint32_t ObjectDB::epoch = 1;
+std::atomic<bool> ObjectDB::debug_iterating = false;
+thread_local ObjectDB::ThreadCache ObjectDB::thread_cache;
+
+ObjectDB::ThreadCache::~ThreadCache() {
+	spin_lock.lock();
+
+	if (state == STATE_ACTIVE) {
+		ThreadCache **E = &thread_caches;
+		while (*E != this) {
+			E = &(*E)->next;
+		}
+		*E = next;
+
+		if (epoch == ObjectDB::epoch) {
+			retired_live += live.load(std::memory_order_relaxed);
+			for (uint32_t i = 0; i < count; i++) {
+				free_slots.push_back(slots[i]);
+			}
+		}
+	}
+
+	// Instances freed later on during thread exit go straight to the global free list.
+	count = 0;
+	state = STATE_RETIRED;
+
+	spin_lock.unlock();
+}
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	spin_lock.lock();
+
+	int64_t count = retired_live;
+	for (const ThreadCache *E = thread_caches; E; E = E->next) {
+		if (E->epoch == epoch) {
+			count += E->live.load(std::memory_order_relaxed);
+		}
+	}
+
+	spin_lock.unlock();
+
+	return count;
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
+ObjectDB::ThreadCache *ObjectDB::_get_thread_cache() {
+	ThreadCache *cache = &thread_cache;
+	if (likely(cache->state == ThreadCache::STATE_ACTIVE && cache->epoch == epoch)) {
+		return cache;
+	}
+	if (cache->state == ThreadCache::STATE_RETIRED) {
+		return nullptr;
+	}
+
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	if (cache->state == ThreadCache::STATE_UNREGISTERED) {
+		cache->next = thread_caches;
+		thread_caches = cache;
+		cache->state = ThreadCache::STATE_ACTIVE;
+	}
+
+	// Either new, or its slots went away with the last cleanup().
+	cache->count = 0;
+	cache->validator = 0;
+	cache->validator_end = 0;
+	cache->live.store(0, std::memory_order_relaxed);
+	cache->epoch = epoch;
+
+	spin_lock.unlock();
+
+	return cache;
+}
+
+// Must be called with the lock held. Returns how many slots could be allocated, which is at least one.
+uint32_t ObjectDB::_alloc_slots(uint32_t *r_slots, uint32_t p_count) {
+	uint32_t count = 0;
+
+	while (count < p_count && !free_slots.is_empty()) {
+		r_slots[count++] = free_slots[free_slots.size() - 1];
+		free_slots.resize(free_slots.size() - 1);
+	}
+
+	while (count < p_count) {
+		if (unlikely(slot_max == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS))) {
+			CRASH_COND(count == 0);
+			break;
 		}
-		slot_max = new_slot_max;
+
+		if ((slot_max & OBJECTDB_CHUNK_MASK) == 0) {
+			ObjectSlot *chunk = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_CHUNK_SIZE);
+			for (uint32_t i = 0; i < OBJECTDB_CHUNK_SIZE; i++) {
+				memnew_placement(&chunk[i], ObjectSlot);
+			}
+			// Readers load the chunk without the lock.
+			chunks[slot_max >> OBJECTDB_CHUNK_BITS].store(chunk, std::memory_order_release);
+		}
+
+		r_slots[count++] = slot_max++;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	return count;
+}
+
+uint64_t ObjectDB::_next_validator(ThreadCache *p_cache) {
+	uint64_t validator;
+	do {
+		if (likely(p_cache)) {
+			if (unlikely(p_cache->validator == p_cache->validator_end)) {
+				p_cache->validator_end = validator_counter.add(ThreadCache::VALIDATOR_BATCH);
+				p_cache->validator = p_cache->validator_end - ThreadCache::VALIDATOR_BATCH;
+			}
+			validator = p_cache->validator++;
+		} else {
+			validator = validator_counter.increment();
+		}
+		validator &= OBJECTDB_VALIDATOR_MASK;
+	} while (unlikely(validator == 0));
+
+	return validator;
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	uint32_t slot;
+	ThreadCache *cache = _get_thread_cache();
+	if (likely(cache)) {
+		if (unlikely(cache->count == 0)) {
+			spin_lock.lock();
+			cache->count = _alloc_slots(cache->slots, ThreadCache::BATCH);
+			spin_lock.unlock();
+		}
+		slot = cache->slots[--cache->count];
+		cache->live.store(cache->live.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	} else {
+		spin_lock.lock();
+		_alloc_slots(&slot, 1);
+		retired_live++;
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
-	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	ObjectSlot &object_slot = _get_slot(slot);
+	ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
+
+	uint64_t id = _next_validator(cache);
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2556,9 +2727,9 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
-
-	spin_lock.unlock();
+	// The object goes first, so a reader that sees the validator also sees it.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(id >> OBJECTDB_SLOT_MAX_COUNT_BITS, std::memory_order_release);
 
 	return ObjectID(id);
 }
@@ -2567,33 +2738,56 @@ void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
 
-	spin_lock.lock();
+	ObjectSlot &object_slot = _get_slot(slot);
 
 #ifdef DEBUG_ENABLED
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
+	ERR_FAIL_COND(object_slot.validator.load(std::memory_order_relaxed) != (t >> OBJECTDB_SLOT_MAX_COUNT_BITS));
+#endif
 
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
-	{
-		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+	ThreadCache *cache = _get_thread_cache();
+
+	// Pairs with debug_objects(): either it sees this flag and waits for the slot to be
+	// invalidated, or this sees it iterating and waits for the lock.
+	bool locked = true;
+	if (likely(cache)) {
+		cache->removing.store(true, std::memory_order_seq_cst);
+		locked = debug_iterating.load(std::memory_order_seq_cst);
+		if (unlikely(locked)) {
+			cache->removing.store(false, std::memory_order_release);
 		}
 	}
+	if (unlikely(locked)) {
+		spin_lock.lock();
+	}
 
-#endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.validator.store(0, std::memory_order_release);
+	object_slot.object.store(nullptr, std::memory_order_release);
 
-	spin_lock.unlock();
+	if (unlikely(locked)) {
+		spin_lock.unlock();
+	} else {
+		cache->removing.store(false, std::memory_order_release);
+	}
+
+	if (likely(cache)) {
+		if (unlikely(cache->count == ThreadCache::SIZE)) {
+			spin_lock.lock();
+			for (uint32_t i = ThreadCache::SIZE - ThreadCache::BATCH; i < ThreadCache::SIZE; i++) {
+				free_slots.push_back(cache->slots[i]);
+			}
+			spin_lock.unlock();
+			cache->count -= ThreadCache::BATCH;
+		}
+		cache->slots[cache->count++] = slot;
+		cache->live.store(cache->live.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+	} else {
+		spin_lock.lock();
+		free_slots.push_back(slot);
+		retired_live--;
+		spin_lock.unlock();
+	}
 }
 
 void ObjectDB::setup() {
@@ -2601,9 +2795,11 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
+	int object_count = get_object_count();
+
 	spin_lock.lock();
 
-	if (slot_count > 0) {
+	if (object_count > 0) {
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
 		if (OS::get_singleton()->is_stdout_verbose()) {
 			// Ensure calling the native classes because if a leaked instance has a script
@@ -2613,9 +2809,10 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0; i < slot_max; i++) {
+				ObjectSlot &object_slot = _get_slot(i);
+				if (object_slot.validator.load(std::memory_order_relaxed)) {
+					Object *obj = object_slot.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2628,20 +2825,28 @@ void ObjectDB::cleanup() {
 						extra_info = " - Reference count: " + itos((static_cast<RefCounted *>(obj))->get_reference_count());
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (object_slot.validator.load(std::memory_order_relaxed) << OBJECTDB_SLOT_MAX_COUNT_BITS);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
-
-					count--;
 				}
 			}
 			print_line("Hint: Leaked instances typically happen when nodes are removed from the scene tree (with `remove_child()`) but not freed (with `free()` or `queue_free()`).");
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < OBJECTDB_CHUNK_MAX_COUNT; i++) {
+		ObjectSlot *chunk = chunks[i].load(std::memory_order_relaxed);
+		if (!chunk) {
+			break;
+		}
+		memfree(chunk);
+		chunks[i].store(nullptr, std::memory_order_relaxed);
 	}
 
+	slot_max = 0;
+	free_slots.reset();
+	retired_live = 0;
+	epoch++;
+
 	spin_lock.unlock();
 }
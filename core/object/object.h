@@ -38,6 +38,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/required_ptr.h"
 #include "core/variant/variant.h"
@@ -635,10 +636,35 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Flat, immutable copy of the slots, built on the first emission after a change.
+		// Emissions hold a reference, so connecting or disconnecting during one is safe.
+		struct Snapshot {
+			struct Entry {
+				Callable callable;
+				MethodBind *method = nullptr; // Set for plain object methods, to skip the lookup on every call.
+				uint32_t flags = 0;
+			};
+
+			SafeRefCount refcount;
+			LocalVector<Entry> entries;
+			bool has_one_shot = false;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot> slot_map;
+		Snapshot *snapshot = nullptr;
 		bool removable = false;
+
+		void invalidate_snapshot();
+
+		SignalData() {}
+		SignalData(const SignalData &p_from) :
+				user(p_from.user), slot_map(p_from.slot_map), removable(p_from.removable) {}
+		SignalData &operator=(const SignalData &p_from);
+		~SignalData() { invalidate_snapshot(); }
 	};
+	static SignalData::Snapshot *_build_signal_snapshot(const SignalData &p_signal);
+
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
 	HashMap<StringName, SignalData> signal_map;
@@ -1077,24 +1103,70 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_BITS 24
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
+// Slots live in fixed chunks that never move, so they can be read without locking.
+#define OBJECTDB_CHUNK_BITS 14
+#define OBJECTDB_CHUNK_SIZE (uint32_t(1) << OBJECTDB_CHUNK_BITS)
+#define OBJECTDB_CHUNK_MASK (OBJECTDB_CHUNK_SIZE - 1)
+#define OBJECTDB_CHUNK_MAX_COUNT (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_CHUNK_BITS))
 
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// The instance ID without its slot index (validator and reference bit), zero if the slot is free.
+		// Set after the object and cleared before it, so readers check it on both sides of loading the object.
+		std::atomic<uint64_t> validator = 0;
+		std::atomic<Object *> object = nullptr;
+	};
+
+	// Free slots and validators owned by a thread, so adding and removing instances
+	// only takes the lock to move slots in batches from and to the global free list.
+	struct ThreadCache {
+		static constexpr uint32_t SIZE = 64;
+		static constexpr uint32_t BATCH = SIZE / 2;
+		static constexpr uint32_t VALIDATOR_BATCH = 256;
+
+		enum State {
+			STATE_UNREGISTERED,
+			STATE_ACTIVE,
+			STATE_RETIRED, // The thread is exiting, go through the global free list.
+		};
+
+		uint32_t slots[SIZE];
+		uint32_t count = 0;
+		uint64_t validator = 0;
+		uint64_t validator_end = 0;
+		// Only written by the owning thread, read by get_object_count().
+		std::atomic<int64_t> live = 0;
+		// Set while the owning thread invalidates a slot, debug_objects() waits for it to clear.
+		std::atomic<bool> removing = false;
+		uint32_t epoch = 0;
+		State state = STATE_UNREGISTERED;
+		ThreadCache *next = nullptr;
+
+		~ThreadCache();
 	};
 
 	static SpinLock spin_lock;
-	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	static std::atomic<ObjectSlot *> chunks[OBJECTDB_CHUNK_MAX_COUNT];
+	static uint32_t slot_max; // Slots ever handed out, every slot below it is in a chunk.
+	static LocalVector<uint32_t> free_slots;
+	static SafeNumeric<uint64_t> validator_counter;
+	static ThreadCache *thread_caches;
+	static int64_t retired_live; // Instance count change of threads without a cache.
+	static uint32_t epoch; // Bumped by cleanup(), thread caches from before it are stale.
+	static std::atomic<bool> debug_iterating; // Removals take the lock while debug_objects() runs.
+	static thread_local ThreadCache thread_cache;
 
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
 
+	_FORCE_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return chunks[p_slot >> OBJECTDB_CHUNK_BITS].load(std::memory_order_relaxed)[p_slot & OBJECTDB_CHUNK_MASK];
+	}
+
+	static ThreadCache *_get_thread_cache();
+	static uint32_t _alloc_slots(uint32_t *r_slots, uint32_t p_count);
+	static uint64_t _next_validator(ThreadCache *p_cache);
+
 	static ObjectID add_instance(Object *p_object);
 	static void remove_instance(Object *p_object);
 
@@ -1107,21 +1179,26 @@ public:
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
+		uint64_t validator = id >> OBJECTDB_SLOT_MAX_COUNT_BITS;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		if (unlikely(validator == 0)) {
+			return nullptr;
+		}
 
-		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ObjectSlot *chunk = chunks[slot >> OBJECTDB_CHUNK_BITS].load(std::memory_order_acquire);
+		ERR_FAIL_NULL_V(chunk, nullptr); // This should never happen unless RID is corrupted.
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		ObjectSlot &object_slot = chunk[slot & OBJECTDB_CHUNK_MASK];
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed and reused while loading the object.
+		if (unlikely(object_slot.validator.load(std::memory_order_acquire) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
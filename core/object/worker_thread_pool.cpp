@@ -72,7 +72,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// about to be run uses scripting, guarantees are held.
 		ScriptServer::thread_enter();
 
-		task_mutex.lock();
+		_lock_task_mutex();
 		p_task->pool_thread_index = pool_thread_index;
 		prev_task = curr_thread.current_task;
 		curr_thread.current_task = p_task;
@@ -88,28 +88,43 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 	bool low_priority = p_task->low_priority;
 #endif
 
+	processed_tasks.increment();
+
 	if (p_task->group) {
 		// Handling a group
 		bool do_post = false;
+		Group *group = p_task->group;
+		const uint32_t users = MAX(1u, group->tasks_used);
 
 		while (true) {
-			uint32_t work_index = p_task->group->index.postincrement();
+			// Claim elements in chunks that shrink as the group drains (guided scheduling),
+			// so large groups don't bounce the shared counters between cores on every element,
+			// while the tail is still handed out one by one to keep the load balanced.
+			uint32_t claimed = group->index.get();
+			if (claimed >= group->max) {
+				break;
+			}
+			uint32_t chunk = MAX(1u, (group->max - claimed) / (users * 2));
+			uint32_t work_index = group->index.postadd(chunk);
 
-			if (work_index >= p_task->group->max) {
+			if (work_index >= group->max) {
 				break;
 			}
-			if (p_task->native_group_func) {
-				p_task->native_group_func(p_task->native_func_userdata, work_index);
-			} else if (p_task->template_userdata) {
-				p_task->template_userdata->callback_indexed(work_index);
-			} else {
-				p_task->callable.call(work_index);
+			uint32_t work_end = MIN(work_index + chunk, group->max);
+			for (uint32_t i = work_index; i < work_end; i++) {
+				if (p_task->native_group_func) {
+					p_task->native_group_func(p_task->native_func_userdata, i);
+				} else if (p_task->template_userdata) {
+					p_task->template_userdata->callback_indexed(i);
+				} else {
+					p_task->callable.call(i);
+				}
 			}
 
 			// This is the only way to ensure posting is done when all tasks are really complete.
-			uint32_t completed_amount = p_task->group->completed_index.increment();
+			uint32_t completed_amount = group->completed_index.add(work_end - work_index);
 
-			if (completed_amount == p_task->group->max) {
+			if (completed_amount == group->max) {
 				do_post = true;
 			}
 		}
@@ -133,7 +148,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 
 		// For groups, tasks get rid of themselves.
 
-		task_mutex.lock();
+		_lock_task_mutex();
 		task_allocator.free(p_task);
 	} else {
 		if (p_task->native_func) {
@@ -145,7 +160,7 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.call();
 		}
 
-		task_mutex.lock();
+		_lock_task_mutex();
 		p_task->completed = true;
 		p_task->pool_thread_index = -1;
 		if (p_task->waiting_user) {
@@ -190,7 +205,8 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 		{
 			// Create the lock outside the inner loop so it isn't needlessly unlocked and relocked
 			//  when no task was found to process, and the loop is re-entered.
-			MutexLock lock(thread_data->pool->task_mutex);
+			thread_data->pool->_lock_task_mutex();
+			MutexLock lock(thread_data->pool->task_mutex, THREADING_NAMESPACE::adopt_lock);
 
 			while (true) {
 				bool exit = thread_data->pool->_handle_runlevel(thread_data, lock);
@@ -244,10 +260,19 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
 
+	// Tasks spawned from within a pool task go first, like in a work-stealing scheduler, so the
+	// spawning thread (or one that waits collaboratively for them) picks them while their data
+	// is still hot, instead of behind everything queued earlier.
+	bool nested = caller_pool_thread && caller_pool_thread->current_task && !p_pump_task;
+
 	for (uint32_t i = 0; i < p_count; i++) {
 		p_tasks[i]->low_priority = !p_high_priority;
 		if (p_high_priority || low_priority_threads_used < max_low_priority_threads) {
-			task_queue.add_last(&p_tasks[i]->task_elem);
+			if (nested) {
+				task_queue.add(&p_tasks[i]->task_elem);
+			} else {
+				task_queue.add_last(&p_tasks[i]->task_elem);
+			}
 			if (!p_high_priority) {
 				low_priority_threads_used++;
 			}
@@ -343,7 +368,8 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *
 }
 
 WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description, bool p_pump_task) {
-	MutexLock<BinaryMutex> lock(task_mutex);
+	_lock_task_mutex();
+	MutexLock<BinaryMutex> lock(task_mutex, THREADING_NAMESPACE::adopt_lock);
 
 	// Get a free task
 	Task *task = task_allocator.alloc();
@@ -490,7 +516,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 		Task *task_to_process = nullptr;
 		bool relock_unlockables = false;
 		{
-			MutexLock lock(task_mutex);
+			_lock_task_mutex();
+			MutexLock lock(task_mutex, THREADING_NAMESPACE::adopt_lock);
 
 			bool was_signaled = p_caller_pool_thread->signaled;
 			p_caller_pool_thread->signaled = false;
@@ -656,7 +683,8 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 		p_tasks = MAX(1u, threads.size());
 	}
 
-	MutexLock<BinaryMutex> lock(task_mutex);
+	_lock_task_mutex();
+	MutexLock<BinaryMutex> lock(task_mutex, THREADING_NAMESPACE::adopt_lock);
 
 	Group *group = group_allocator.alloc();
 	GroupID id = last_task++;
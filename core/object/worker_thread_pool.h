@@ -62,7 +62,7 @@ private:
 
 	struct Group {
 		GroupID self = -1;
-		SafeNumeric<uint32_t> index;
+		SafeNumeric<uint32_t> index; // Next element to hand out. Elements are claimed in chunks.
 		SafeNumeric<uint32_t> completed_index;
 		uint32_t max = 0;
 		Semaphore done_semaphore;
@@ -109,6 +109,17 @@ private:
 
 	BinaryMutex task_mutex;
 
+	// Statistics, exposed through Performance.
+	SafeNumeric<uint64_t> task_mutex_contentions;
+	SafeNumeric<uint64_t> processed_tasks;
+
+	_FORCE_INLINE_ void _lock_task_mutex() {
+		if (!task_mutex.try_lock()) {
+			task_mutex_contentions.increment();
+			task_mutex.lock();
+		}
+	}
+
 	struct ThreadData {
 		static Task *const YIELDING; // Too bad constexpr doesn't work here.
 
@@ -267,6 +278,10 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// Totals since the pool was started.
+	uint64_t get_task_mutex_contention_count() const { return task_mutex_contentions.get(); }
+	uint64_t get_processed_task_count() const { return processed_tasks.get(); }
+
 	_FORCE_INLINE_ int get_thread_count() const {
 #ifdef THREADS_ENABLED
 		return threads.size();
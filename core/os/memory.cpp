@@ -30,10 +30,12 @@
 
 #include "memory.h"
 
+#include "core/os/spin_lock.h"
 #include "core/profiling/profiling.h"
 #include "core/templates/safe_refcount.h"
 
 #include <cstdlib>
+#include <cstring>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -57,11 +59,236 @@ void operator delete(void *p_mem, void *p_pointer, size_t check, const char *p_d
 }
 #endif
 
-#ifdef DEBUG_ENABLED
+#if defined(DEBUG_ENABLED) || defined(POOLED_ALLOCATOR_ENABLED)
+// Every allocation has a header with its size and tag, so usage can be accounted.
+#define MEMORY_HEADER_ALWAYS
 static SafeNumeric<uint64_t> _current_mem_usage;
 static SafeNumeric<uint64_t> _max_mem_usage;
+static SafeNumeric<uint64_t> _tag_mem_usage[Memory::TAG_MAX];
 #endif
 
+// The tag is kept in the top byte of the size stored in the allocation header.
+static constexpr int HEADER_TAG_SHIFT = 56;
+static constexpr uint64_t HEADER_SIZE_MASK = (uint64_t(1) << HEADER_TAG_SHIFT) - 1;
+
+#ifdef POOLED_ALLOCATOR_ENABLED
+// Blocks up to POOL_MAX_BLOCK_SIZE bytes (header included) are carved out of slabs
+// by size class instead of going to malloc, so long-running processes don't fragment
+// the heap with small allocations. Each thread keeps a few free blocks of every class
+// and only locks the class to move blocks in batches. Slabs are never returned.
+
+static constexpr uint32_t POOL_SMALL_CLASS_COUNT = 8; // 16 byte steps up to 128.
+static constexpr uint32_t POOL_CLASS_COUNT = POOL_SMALL_CLASS_COUNT + 4 * 5; // Four steps per doubling up to 4096.
+static constexpr size_t POOL_MAX_BLOCK_SIZE = 4096;
+static constexpr size_t POOL_SLAB_SIZE = 64 * 1024;
+static constexpr uint32_t POOL_CACHE_MAX = 64;
+static constexpr uint32_t POOL_CACHE_BATCH = POOL_CACHE_MAX / 2;
+
+struct PoolBlock {
+	PoolBlock *next;
+};
+
+struct PoolClass {
+	SpinLock lock;
+	PoolBlock *free_list = nullptr;
+};
+
+static PoolClass _pool_classes[POOL_CLASS_COUNT];
+static SafeNumeric<uint64_t> _pool_reserved;
+
+struct PoolThreadCache {
+	PoolBlock *blocks[POOL_CLASS_COUNT] = {};
+	uint32_t counts[POOL_CLASS_COUNT] = {};
+	bool retired = false; // The thread is exiting, use the classes directly.
+
+	~PoolThreadCache();
+};
+
+static thread_local PoolThreadCache _pool_thread_cache;
+
+static constexpr uint32_t _pool_class_index(size_t p_size) {
+	if (p_size <= 128) {
+		return p_size == 0 ? 0 : uint32_t((p_size - 1) >> 4);
+	}
+	uint32_t shift = 0;
+	while ((size_t(1) << (shift + 1)) <= p_size - 1) {
+		shift++;
+	}
+	return POOL_SMALL_CLASS_COUNT + (shift - 7) * 4 + uint32_t((p_size - 1) >> (shift - 2)) - 4;
+}
+
+static constexpr size_t _pool_class_size(uint32_t p_index) {
+	if (p_index < POOL_SMALL_CLASS_COUNT) {
+		return size_t(p_index + 1) << 4;
+	}
+	uint32_t shift = 7 + (p_index - POOL_SMALL_CLASS_COUNT) / 4;
+	return size_t(5 + (p_index - POOL_SMALL_CLASS_COUNT) % 4) << (shift - 2);
+}
+
+static_assert(_pool_class_index(POOL_MAX_BLOCK_SIZE) == POOL_CLASS_COUNT - 1);
+static_assert(_pool_class_size(POOL_CLASS_COUNT - 1) == POOL_MAX_BLOCK_SIZE);
+static_assert(_pool_class_size(_pool_class_index(129)) == 160);
+
+// Must be called with the class locked.
+static PoolBlock *_pool_take(uint32_t p_class, uint32_t p_count, uint32_t &r_taken) {
+	PoolClass &pool_class = _pool_classes[p_class];
+	if (!pool_class.free_list) {
+		const size_t block_size = _pool_class_size(p_class);
+		uint8_t *slab = (uint8_t *)malloc(POOL_SLAB_SIZE);
+		if (!slab) {
+			r_taken = 0;
+			return nullptr;
+		}
+		_pool_reserved.add(POOL_SLAB_SIZE);
+
+		for (size_t offset = POOL_SLAB_SIZE / block_size * block_size; offset > 0; offset -= block_size) {
+			PoolBlock *block = (PoolBlock *)(slab + offset - block_size);
+			block->next = pool_class.free_list;
+			pool_class.free_list = block;
+		}
+	}
+
+	PoolBlock *first = pool_class.free_list;
+	PoolBlock *last = first;
+	r_taken = 1;
+	while (r_taken < p_count && last->next) {
+		last = last->next;
+		r_taken++;
+	}
+	pool_class.free_list = last->next;
+	last->next = nullptr;
+	return first;
+}
+
+static void _pool_give(uint32_t p_class, PoolBlock *p_first, PoolBlock *p_last) {
+	PoolClass &pool_class = _pool_classes[p_class];
+	pool_class.lock.lock();
+	p_last->next = pool_class.free_list;
+	pool_class.free_list = p_first;
+	pool_class.lock.unlock();
+}
+
+PoolThreadCache::~PoolThreadCache() {
+	for (uint32_t i = 0; i < POOL_CLASS_COUNT; i++) {
+		if (blocks[i]) {
+			PoolBlock *last = blocks[i];
+			while (last->next) {
+				last = last->next;
+			}
+			_pool_give(i, blocks[i], last);
+			blocks[i] = nullptr;
+			counts[i] = 0;
+		}
+	}
+	retired = true;
+}
+
+static void *_pool_alloc(uint32_t p_class) {
+	PoolThreadCache &cache = _pool_thread_cache;
+	PoolBlock *block = cache.blocks[p_class];
+
+	if (unlikely(!block)) {
+		uint32_t taken;
+		PoolClass &pool_class = _pool_classes[p_class];
+		pool_class.lock.lock();
+		block = _pool_take(p_class, cache.retired ? 1 : POOL_CACHE_BATCH, taken);
+		pool_class.lock.unlock();
+		if (unlikely(!block)) {
+			return nullptr;
+		}
+		if (cache.retired) {
+			return block;
+		}
+		cache.counts[p_class] = taken;
+	}
+
+	cache.blocks[p_class] = block->next;
+	cache.counts[p_class]--;
+	return block;
+}
+
+static void _pool_free(void *p_mem, uint32_t p_class) {
+	PoolThreadCache &cache = _pool_thread_cache;
+	PoolBlock *block = (PoolBlock *)p_mem;
+
+	if (unlikely(cache.retired)) {
+		_pool_give(p_class, block, block);
+		return;
+	}
+
+	if (unlikely(cache.counts[p_class] == POOL_CACHE_MAX)) {
+		// Hand the oldest half back, the most recently freed blocks are likely still in cache.
+		PoolBlock *last = cache.blocks[p_class];
+		for (uint32_t i = 1; i < POOL_CACHE_MAX - POOL_CACHE_BATCH; i++) {
+			last = last->next;
+		}
+		PoolBlock *first = last->next;
+		last->next = nullptr;
+		PoolBlock *tail = first;
+		while (tail->next) {
+			tail = tail->next;
+		}
+		_pool_give(p_class, first, tail);
+		cache.counts[p_class] -= POOL_CACHE_BATCH;
+	}
+
+	block->next = cache.blocks[p_class];
+	cache.blocks[p_class] = block;
+	cache.counts[p_class]++;
+}
+#endif // POOLED_ALLOCATOR_ENABLED
+
+template <bool p_ensure_zero>
+static _FORCE_INLINE_ void *_alloc_block(size_t p_bytes) {
+#ifdef POOLED_ALLOCATOR_ENABLED
+	if (p_bytes <= POOL_MAX_BLOCK_SIZE) {
+		void *mem = _pool_alloc(_pool_class_index(p_bytes));
+		if constexpr (p_ensure_zero) {
+			if (mem) {
+				memset(mem, 0, p_bytes);
+			}
+		}
+		return mem;
+	}
+#endif
+	if constexpr (p_ensure_zero) {
+		return calloc(1, p_bytes);
+	} else {
+		return malloc(p_bytes);
+	}
+}
+
+static _FORCE_INLINE_ void *_realloc_block(void *p_mem, size_t p_prev_bytes, size_t p_bytes) {
+#ifdef POOLED_ALLOCATOR_ENABLED
+	if (p_prev_bytes <= POOL_MAX_BLOCK_SIZE || p_bytes <= POOL_MAX_BLOCK_SIZE) {
+		if (p_prev_bytes <= POOL_MAX_BLOCK_SIZE && p_bytes <= POOL_MAX_BLOCK_SIZE && _pool_class_index(p_prev_bytes) == _pool_class_index(p_bytes)) {
+			return p_mem;
+		}
+		void *mem = _alloc_block<false>(p_bytes);
+		if (mem) {
+			memcpy(mem, p_mem, MIN(p_prev_bytes, p_bytes));
+			if (p_prev_bytes <= POOL_MAX_BLOCK_SIZE) {
+				_pool_free(p_mem, _pool_class_index(p_prev_bytes));
+			} else {
+				free(p_mem);
+			}
+		}
+		return mem;
+	}
+#endif
+	return realloc(p_mem, p_bytes);
+}
+
+static _FORCE_INLINE_ void _free_block(void *p_mem, size_t p_bytes) {
+#ifdef POOLED_ALLOCATOR_ENABLED
+	if (p_bytes <= POOL_MAX_BLOCK_SIZE) {
+		_pool_free(p_mem, _pool_class_index(p_bytes));
+		return;
+	}
+#endif
+	free(p_mem);
+}
+
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
 	DEV_ASSERT(is_power_of_2(p_alignment));
 
@@ -97,19 +324,14 @@ void Memory::free_aligned_static(void *p_memory) {
 }
 
 template <bool p_ensure_zero>
-void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
-#ifdef DEBUG_ENABLED
+void *Memory::alloc_static(size_t p_bytes, bool p_pad_align, Tag p_tag) {
+#ifdef MEMORY_HEADER_ALWAYS
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem;
-	if constexpr (p_ensure_zero) {
-		mem = calloc(1, p_bytes + (prepad ? DATA_OFFSET : 0));
-	} else {
-		mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
-	}
+	void *mem = _alloc_block<p_ensure_zero>(p_bytes + (prepad ? DATA_OFFSET : 0));
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 	GodotProfileAlloc(mem, p_bytes + (prepad ? DATA_OFFSET : 0));
@@ -117,12 +339,14 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		uint8_t *s8 = (uint8_t *)mem;
 
+		const Tag tag = p_tag == TAG_CURRENT ? current_tag : p_tag;
 		uint64_t *s = (uint64_t *)(s8 + SIZE_OFFSET);
-		*s = p_bytes;
+		*s = p_bytes | (uint64_t(tag) << HEADER_TAG_SHIFT);
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_HEADER_ALWAYS
 		uint64_t new_mem_usage = _current_mem_usage.add(p_bytes);
 		_max_mem_usage.exchange_if_greater(new_mem_usage);
+		_tag_mem_usage[tag].add(p_bytes);
 #endif
 		return s8 + DATA_OFFSET;
 	} else {
@@ -130,8 +354,8 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	}
 }
 
-template void *Memory::alloc_static<true>(size_t p_bytes, bool p_pad_align);
-template void *Memory::alloc_static<false>(size_t p_bytes, bool p_pad_align);
+template void *Memory::alloc_static<true>(size_t p_bytes, bool p_pad_align, Tag p_tag);
+template void *Memory::alloc_static<false>(size_t p_bytes, bool p_pad_align, Tag p_tag);
 
 void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (p_memory == nullptr) {
@@ -140,7 +364,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_memory;
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_HEADER_ALWAYS
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -149,31 +373,33 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
+		const uint64_t prev_bytes = *s & HEADER_SIZE_MASK;
+		const Tag tag = Tag(*s >> HEADER_TAG_SHIFT);
 
-#ifdef DEBUG_ENABLED
-		if (p_bytes > *s) {
-			uint64_t new_mem_usage = _current_mem_usage.add(p_bytes - *s);
+#ifdef MEMORY_HEADER_ALWAYS
+		if (p_bytes > prev_bytes) {
+			uint64_t new_mem_usage = _current_mem_usage.add(p_bytes - prev_bytes);
 			_max_mem_usage.exchange_if_greater(new_mem_usage);
+			_tag_mem_usage[tag].add(p_bytes - prev_bytes);
 		} else {
-			_current_mem_usage.sub(*s - p_bytes);
+			_current_mem_usage.sub(prev_bytes - p_bytes);
+			_tag_mem_usage[tag].sub(prev_bytes - p_bytes);
 		}
 #endif
 
 		if (p_bytes == 0) {
 			GodotProfileFree(mem);
-			free(mem);
+			_free_block(mem, prev_bytes + DATA_OFFSET);
 			return nullptr;
 		} else {
-			*s = p_bytes;
-
 			GodotProfileFree(mem);
-			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
+			mem = (uint8_t *)_realloc_block(mem, prev_bytes + DATA_OFFSET, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 			GodotProfileAlloc(mem, p_bytes + DATA_OFFSET);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
 
-			*s = p_bytes;
+			*s = p_bytes | (uint64_t(tag) << HEADER_TAG_SHIFT);
 
 			return mem + DATA_OFFSET;
 		}
@@ -193,7 +419,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_ptr;
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_HEADER_ALWAYS
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -202,13 +428,15 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	if (prepad) {
 		mem -= DATA_OFFSET;
 
-#ifdef DEBUG_ENABLED
 		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
-		_current_mem_usage.sub(*s);
+		const uint64_t bytes = *s & HEADER_SIZE_MASK;
+#ifdef MEMORY_HEADER_ALWAYS
+		_current_mem_usage.sub(bytes);
+		_tag_mem_usage[*s >> HEADER_TAG_SHIFT].sub(bytes);
 #endif
 
 		GodotProfileFree(mem);
-		free(mem);
+		_free_block(mem, bytes + DATA_OFFSET);
 	} else {
 		GodotProfileFree(mem);
 		free(mem);
@@ -220,7 +448,7 @@ uint64_t Memory::get_mem_available() {
 }
 
 uint64_t Memory::get_mem_usage() {
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_HEADER_ALWAYS
 	return _current_mem_usage.get();
 #else
 	return 0;
@@ -228,13 +456,30 @@ uint64_t Memory::get_mem_usage() {
 }
 
 uint64_t Memory::get_mem_max_usage() {
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_HEADER_ALWAYS
 	return _max_mem_usage.get();
 #else
 	return 0;
 #endif
 }
 
+uint64_t Memory::get_mem_usage(Tag p_tag) {
+	ERR_FAIL_INDEX_V(p_tag, TAG_MAX, 0);
+#ifdef MEMORY_HEADER_ALWAYS
+	return _tag_mem_usage[p_tag].get();
+#else
+	return 0;
+#endif
+}
+
+uint64_t Memory::get_mem_pool_reserved() {
+#ifdef POOLED_ALLOCATOR_ENABLED
+	return _pool_reserved.get();
+#else
+	return 0;
+#endif
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
@@ -61,8 +61,48 @@ inline constexpr size_t SIZE_OFFSET = 0;
 inline constexpr size_t ELEMENT_OFFSET = get_aligned_address(SIZE_OFFSET + sizeof(uint64_t), alignof(uint64_t));
 inline constexpr size_t DATA_OFFSET = get_aligned_address(ELEMENT_OFFSET + sizeof(uint64_t), MAX_ALIGN);
 
+// Subsystems that memory usage is accounted to. Only tracked in builds where every
+// allocation has a header, that is debug builds and builds with the pooled allocator.
+enum Tag : uint8_t {
+	TAG_GENERAL,
+	TAG_VARIANT,
+	TAG_COWDATA,
+	TAG_RID_OWNER,
+	TAG_RENDERING,
+	TAG_PHYSICS,
+	TAG_SCRIPT,
+	TAG_MAX,
+	TAG_CURRENT = 0xFF, // The tag of the innermost TagScope of the calling thread.
+};
+
+#if defined(DEBUG_ENABLED) || defined(POOLED_ALLOCATOR_ENABLED)
+inline thread_local Tag current_tag = TAG_GENERAL;
+
+// Accounts allocations that don't pass a tag to p_tag while in scope.
+class TagScope {
+	Tag previous;
+
+public:
+	_FORCE_INLINE_ explicit TagScope(Tag p_tag) {
+		previous = current_tag;
+		current_tag = p_tag;
+	}
+	_FORCE_INLINE_ ~TagScope() {
+		current_tag = previous;
+	}
+};
+#else
+// Usage isn't tracked, so scopes are free.
+inline constexpr Tag current_tag = TAG_GENERAL;
+
+class TagScope {
+public:
+	_FORCE_INLINE_ explicit TagScope(Tag p_tag) {}
+};
+#endif
+
 template <bool p_ensure_zero = false>
-void *alloc_static(size_t p_bytes, bool p_pad_align = false);
+void *alloc_static(size_t p_bytes, bool p_pad_align = false, Tag p_tag = TAG_CURRENT);
 _FORCE_INLINE_ static void *alloc_static_zeroed(size_t p_bytes, bool p_pad_align = false) {
 	return alloc_static<true>(p_bytes, p_pad_align);
 }
@@ -96,6 +136,9 @@ void free_aligned_static(void *p_memory);
 uint64_t get_mem_available();
 uint64_t get_mem_usage();
 uint64_t get_mem_max_usage();
+uint64_t get_mem_usage(Tag p_tag);
+// Bytes held by the pooled allocator, used or not. Zero if it's not enabled.
+uint64_t get_mem_pool_reserved();
 }; //namespace Memory
 
 class DefaultAllocator {
@@ -76,6 +76,10 @@ public:
 	explicit MutexLock(const MutexT &p_mutex) :
 			lock(p_mutex.mutex) {}
 
+	// Takes over a mutex the caller has already locked.
+	MutexLock(const MutexT &p_mutex, THREADING_NAMESPACE::adopt_lock_t) :
+			lock(p_mutex.mutex, THREADING_NAMESPACE::adopt_lock) {}
+
 	// Clarification: all the funny syntax is needed so this function exists only for binary mutexes.
 	template <typename T = MutexT>
 	_ALWAYS_INLINE_ THREADING_NAMESPACE::unique_lock<THREADING_NAMESPACE::mutex> &_get_lock(
@@ -117,6 +121,7 @@ template <typename MutexT>
 class MutexLock {
 public:
 	MutexLock(const MutexT &p_mutex) {}
+	MutexLock(const MutexT &p_mutex, THREADING_NAMESPACE::adopt_lock_t) {}
 
 	void temp_relock() const {}
 	void temp_unlock() const {}
@@ -43,6 +43,7 @@
 #include "core/input/input.h"
 #include "core/input/input_map.h"
 #include "core/input/shortcut.h"
+#include "core/io/compression.h"
 #include "core/io/config_file.h"
 #include "core/io/dir_access.h"
 #include "core/io/dtls_server.h"
@@ -476,6 +477,8 @@ void unregister_core_types() {
 
 	ResourceLoader::finalize();
 
+	Compression::clear_zstd_dictionaries();
+
 	ClassDB::cleanup_defaults();
 	memdelete(_time);
 	ObjectDB::cleanup();
@@ -49,6 +49,7 @@ class PagedAllocator {
 	uint32_t page_shift = 0;
 	uint32_t page_mask = 0;
 	uint32_t page_size = 0;
+	Memory::Tag memory_tag = Memory::TAG_CURRENT;
 	SpinLock spin_lock;
 
 public:
@@ -64,8 +65,8 @@ public:
 			page_pool = (T **)memrealloc(page_pool, sizeof(T *) * pages_allocated);
 			available_pool = (T ***)memrealloc(available_pool, sizeof(T **) * pages_allocated);
 
-			page_pool[pages_used] = (T *)memalloc(sizeof(T) * page_size);
-			available_pool[pages_used] = (T **)memalloc(sizeof(T *) * page_size);
+			page_pool[pages_used] = (T *)Memory::alloc_static(sizeof(T) * page_size, false, memory_tag);
+			available_pool[pages_used] = (T **)Memory::alloc_static(sizeof(T *) * page_size, false, memory_tag);
 
 			for (uint32_t i = 0; i < page_size; i++) {
 				available_pool[0][i] = &page_pool[pages_used][i];
@@ -155,7 +156,8 @@ public:
 
 	// Power of 2 recommended because of alignment with OS page sizes.
 	// Even if element is bigger, it's still a multiple and gets rounded to amount of pages.
-	PagedAllocator(uint32_t p_page_size = DEFAULT_PAGE_SIZE) {
+	PagedAllocator(uint32_t p_page_size = DEFAULT_PAGE_SIZE, Memory::Tag p_memory_tag = Memory::TAG_CURRENT) {
+		memory_tag = p_memory_tag;
 		configure(p_page_size);
 	}
 
@@ -137,12 +137,12 @@ class RID_Alloc : public RID_AllocBase {
 			if constexpr (!THREAD_SAFE) {
 				chunks = (Chunk **)memrealloc(chunks, sizeof(Chunk *) * (chunk_count + 1));
 			}
-			chunks[chunk_count] = (Chunk *)memalloc(sizeof(Chunk) * elements_in_chunk); //but don't initialize
+			chunks[chunk_count] = (Chunk *)Memory::alloc_static(sizeof(Chunk) * elements_in_chunk, false, Memory::TAG_RID_OWNER); //but don't initialize
 			//grow free lists
 			if constexpr (!THREAD_SAFE) {
 				free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
 			}
-			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+			free_list_chunks[chunk_count] = (uint32_t *)Memory::alloc_static(sizeof(uint32_t) * elements_in_chunk, false, Memory::TAG_RID_OWNER);
 
 			//initialize
 			for (uint32_t i = 0; i < elements_in_chunk; i++) {
@@ -36,9 +36,9 @@
 #include "core/math/math_funcs.h"
 #include "core/variant/variant_parser.h"
 
-PagedAllocator<Variant::Pools::BucketSmall, true> Variant::Pools::_bucket_small;
-PagedAllocator<Variant::Pools::BucketMedium, true> Variant::Pools::_bucket_medium;
-PagedAllocator<Variant::Pools::BucketLarge, true> Variant::Pools::_bucket_large;
+PagedAllocator<Variant::Pools::BucketSmall, true> Variant::Pools::_bucket_small(4096, Memory::TAG_VARIANT);
+PagedAllocator<Variant::Pools::BucketMedium, true> Variant::Pools::_bucket_medium(4096, Memory::TAG_VARIANT);
+PagedAllocator<Variant::Pools::BucketLarge, true> Variant::Pools::_bucket_large(4096, Memory::TAG_VARIANT);
 
 String Variant::get_type_name(Variant::Type p_type) {
 	switch (p_type) {
@@ -36,6 +36,9 @@
 #include "core/string/print_string.h"
 
 #include <fcntl.h>
+#if !defined(WEB_ENABLED)
+#include <sys/mman.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -199,11 +202,22 @@ Error FileAccessUnix::open_internal(const String &p_path, int p_mode_flags) {
 	return OK;
 }
 
+void FileAccessUnix::_unmap() {
+#if !defined(WEB_ENABLED)
+	if (mapped_data) {
+		munmap(mapped_data, mapped_size);
+	}
+#endif
+	mapped_data = nullptr;
+	mapped_size = 0;
+}
+
 void FileAccessUnix::_close() {
 	if (!f) {
 		return;
 	}
 
+	_unmap();
 	fclose(f);
 	f = nullptr;
 
@@ -624,6 +638,38 @@ void FileAccessUnix::close() {
 	_close();
 }
 
+const uint8_t *FileAccessUnix::map_read_only(uint64_t &r_size) {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+#if defined(WEB_ENABLED)
+	return nullptr;
+#else
+	if (mapped_data) {
+		r_size = mapped_size;
+		return (const uint8_t *)mapped_data;
+	}
+
+	if (flags & WRITE) {
+		return nullptr; // Only read-only files can be mapped, writes would bypass the mapping.
+	}
+
+	uint64_t size = get_length();
+	if (size == 0 || size > (uint64_t)SIZE_MAX) {
+		return nullptr;
+	}
+
+	void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileno(f), 0);
+	if (data == MAP_FAILED) {
+		return nullptr;
+	}
+
+	mapped_data = data;
+	mapped_size = size;
+	r_size = size;
+	return (const uint8_t *)data;
+#endif
+}
+
 FileAccessUnix::CloseNotificationFunc FileAccessUnix::close_notification_func = nullptr;
 
 FileAccessUnix::~FileAccessUnix() {
@@ -47,6 +47,10 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	void *mapped_data = nullptr;
+	uint64_t mapped_size = 0;
+
+	void _unmap();
 	void _close();
 
 #if defined(TOOLS_ENABLED)
@@ -98,6 +102,8 @@ public:
 
 	virtual void close() override;
 
+	virtual const uint8_t *map_read_only(uint64_t &r_size) override;
+
 	FileAccessUnix() {}
 	virtual ~FileAccessUnix();
 };
@@ -233,11 +233,24 @@ Error FileAccessWindows::open_internal(const String &p_path, int p_mode_flags) {
 	}
 }
 
+void FileAccessWindows::_unmap() {
+	if (mapped_data) {
+		UnmapViewOfFile(mapped_data);
+	}
+	if (mapping_handle) {
+		CloseHandle((HANDLE)mapping_handle);
+	}
+	mapping_handle = nullptr;
+	mapped_data = nullptr;
+	mapped_size = 0;
+}
+
 void FileAccessWindows::_close() {
 	if (!f) {
 		return;
 	}
 
+	_unmap();
 	fclose(f);
 	f = nullptr;
 
@@ -685,6 +698,46 @@ void FileAccessWindows::close() {
 	_close();
 }
 
+const uint8_t *FileAccessWindows::map_read_only(uint64_t &r_size) {
+	ERR_FAIL_NULL_V_MSG(f, nullptr, "File must be opened before use.");
+
+	if (mapped_data) {
+		r_size = mapped_size;
+		return mapped_data;
+	}
+
+	if (flags & WRITE) {
+		return nullptr; // Only read-only files can be mapped, writes would bypass the mapping.
+	}
+
+	uint64_t size = get_length();
+	if (size == 0 || size > (uint64_t)SIZE_MAX) {
+		return nullptr;
+	}
+
+	HANDLE file_handle = (HANDLE)_get_osfhandle(_fileno(f));
+	if (file_handle == INVALID_HANDLE_VALUE) {
+		return nullptr;
+	}
+
+	HANDLE handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!handle) {
+		return nullptr;
+	}
+
+	const uint8_t *data = (const uint8_t *)MapViewOfFile(handle, FILE_MAP_READ, 0, 0, 0);
+	if (!data) {
+		CloseHandle(handle);
+		return nullptr;
+	}
+
+	mapping_handle = handle;
+	mapped_data = data;
+	mapped_size = size;
+	r_size = size;
+	return data;
+}
+
 FileAccessWindows::~FileAccessWindows() {
 	_close();
 }
@@ -48,6 +48,11 @@ class FileAccessWindows : public FileAccess {
 	String path_src;
 	String save_path;
 
+	void *mapping_handle = nullptr;
+	const uint8_t *mapped_data = nullptr;
+	uint64_t mapped_size = 0;
+
+	void _unmap();
 	void _close();
 
 	static HashSet<String> invalid_files;
@@ -97,6 +102,8 @@ public:
 
 	virtual void close() override;
 
+	virtual const uint8_t *map_read_only(uint64_t &r_size) override;
+
 	static void initialize();
 	static void finalize();
 
@@ -31,6 +31,7 @@
 #include "performance.h"
 #include "performance.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -133,6 +134,18 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(THREAD_POOL_TASKS_PROCESSED);
+	BIND_ENUM_CONSTANT(THREAD_POOL_LOCK_CONTENTIONS);
+	BIND_ENUM_CONSTANT(OBJECT_NODE_PATH_CACHE_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_NODE_PATH_CACHE_MISSES);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_GENERAL);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_VARIANT);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_COWDATA);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_RID_OWNER);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_RENDERING);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_PHYSICS);
+	BIND_ENUM_CONSTANT(MEMORY_STATIC_SCRIPT);
+	BIND_ENUM_CONSTANT(MEMORY_POOL_RESERVED);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
@@ -228,6 +241,18 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("thread_pool/tasks_processed"),
+		PNAME("thread_pool/lock_contentions"),
+		PNAME("object/node_path_cache_hits"),
+		PNAME("object/node_path_cache_misses"),
+		PNAME("memory/static_general"),
+		PNAME("memory/static_variant"),
+		PNAME("memory/static_cowdata"),
+		PNAME("memory/static_rid_owner"),
+		PNAME("memory/static_rendering"),
+		PNAME("memory/static_physics"),
+		PNAME("memory/static_script"),
+		PNAME("memory/pool_reserved"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -315,6 +340,30 @@ double Performance::get_monitor(Monitor p_monitor) const {
 
 		case AUDIO_OUTPUT_LATENCY:
 			return AudioServer::get_singleton()->get_output_latency();
+		case THREAD_POOL_TASKS_PROCESSED:
+			return WorkerThreadPool::get_singleton()->get_processed_task_count();
+		case THREAD_POOL_LOCK_CONTENTIONS:
+			return WorkerThreadPool::get_singleton()->get_task_mutex_contention_count();
+		case OBJECT_NODE_PATH_CACHE_HITS:
+			return Node::path_cache_hits;
+		case OBJECT_NODE_PATH_CACHE_MISSES:
+			return Node::path_cache_misses;
+		case MEMORY_STATIC_GENERAL:
+			return Memory::get_mem_usage(Memory::TAG_GENERAL);
+		case MEMORY_STATIC_VARIANT:
+			return Memory::get_mem_usage(Memory::TAG_VARIANT);
+		case MEMORY_STATIC_COWDATA:
+			return Memory::get_mem_usage(Memory::TAG_COWDATA);
+		case MEMORY_STATIC_RID_OWNER:
+			return Memory::get_mem_usage(Memory::TAG_RID_OWNER);
+		case MEMORY_STATIC_RENDERING:
+			return Memory::get_mem_usage(Memory::TAG_RENDERING);
+		case MEMORY_STATIC_PHYSICS:
+			return Memory::get_mem_usage(Memory::TAG_PHYSICS);
+		case MEMORY_STATIC_SCRIPT:
+			return Memory::get_mem_usage(Memory::TAG_SCRIPT);
+		case MEMORY_POOL_RESERVED:
+			return Memory::get_mem_pool_reserved();
 
 			// Deprecated, use the 2D/3D specific ones instead.
 		case NAVIGATION_ACTIVE_MAPS:
@@ -525,7 +574,18 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
-
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
 
@@ -121,6 +121,18 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		THREAD_POOL_TASKS_PROCESSED,
+		THREAD_POOL_LOCK_CONTENTIONS,
+		OBJECT_NODE_PATH_CACHE_HITS,
+		OBJECT_NODE_PATH_CACHE_MISSES,
+		MEMORY_STATIC_GENERAL,
+		MEMORY_STATIC_VARIANT,
+		MEMORY_STATIC_COWDATA,
+		MEMORY_STATIC_RID_OWNER,
+		MEMORY_STATIC_RENDERING,
+		MEMORY_STATIC_PHYSICS,
+		MEMORY_STATIC_SCRIPT,
+		MEMORY_POOL_RESERVED,
 		MONITOR_MAX
 	};
 
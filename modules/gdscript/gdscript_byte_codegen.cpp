@@ -150,6 +150,7 @@ void GDScriptByteCodeGenerator::start_parameters() {
 	if (function->_default_arg_count > 0) {
 		append(GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT);
 		function->default_arguments.push_back(opcodes.size());
+		last_jump_target_pos = opcodes.size();
 	}
 }
 
@@ -613,6 +614,9 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		last_operator_pos = opcodes.size();
+		last_operator_target = p_target;
+
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -638,6 +642,18 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 }
 
+bool GDScriptByteCodeGenerator::can_fuse_operator_result(const Address &p_result) const {
+	// The validated operator must be the last emitted instruction, must write into the address
+	// being consumed, and no jump may land between it and the consumer.
+	if (last_operator_pos < 0 || opcodes.size() != last_operator_pos + 5 || last_jump_target_pos == opcodes.size()) {
+		return false;
+	}
+	if (opcodes[last_operator_pos] != GDScriptFunction::OPCODE_OPERATOR_VALIDATED) {
+		return false;
+	}
+	return p_result.mode == GDScriptCodeGenerator::Address::TEMPORARY && last_operator_target.mode == p_result.mode && last_operator_target.address == p_result.address;
+}
+
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const GDScriptDataType &p_type) {
 	switch (p_type.kind) {
 		case GDScriptDataType::BUILTIN: {
@@ -992,6 +1008,11 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_target);
 		append(p_source);
 		append(p_target.type.builtin_type);
+	} else if (can_fuse_operator_result(p_source)) {
+		// Turn the preceding validated operator into one that also stores its result.
+		opcodes.write[last_operator_pos] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_ASSIGN;
+		append(p_target);
+		last_operator_pos = -1;
 	} else {
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
 		append(p_target);
@@ -1021,6 +1042,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 		write_assign(p_dst, p_src);
 	}
 	function->default_arguments.push_back(opcodes.size());
+	last_jump_target_pos = opcodes.size();
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
@@ -1509,8 +1531,14 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (can_fuse_operator_result(p_condition)) {
+		// Compare and branch in a single instruction.
+		opcodes.write[last_operator_pos] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+		last_operator_pos = -1;
+	} else {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1780,12 +1808,18 @@ void GDScriptByteCodeGenerator::write_endfor(bool p_is_range) {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	last_jump_target_pos = opcodes.size();
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	if (can_fuse_operator_result(p_condition)) {
+		opcodes.write[last_operator_pos] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+		last_operator_pos = -1;
+	} else {
+		append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+		append(p_condition);
+	}
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
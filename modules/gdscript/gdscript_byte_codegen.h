@@ -100,6 +100,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 	int current_line = 0;
 	int instr_args_max = 0;
 
+	// Peephole state used to fuse a validated operator with the instruction consuming its result.
+	int last_operator_pos = -1;
+	Address last_operator_target;
+	int last_jump_target_pos = -1;
+
 #ifdef DEBUG_ENABLED
 	List<int> temp_stack;
 #endif
@@ -453,8 +458,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		last_jump_target_pos = opcodes.size();
 	}
 
+	bool can_fuse_operator_result(const Address &p_result) const;
+
 public:
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
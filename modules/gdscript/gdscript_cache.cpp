@@ -34,8 +34,16 @@
 #include "gdscript_analyzer.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
+#include "gdscript_tokenizer_buffer.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/crypto/crypto_core.h"
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/templates/vector.h"
 
 GDScriptParserRef::Status GDScriptParserRef::get_status() const {
@@ -82,8 +90,14 @@ Error GDScriptParserRef::raise_status(Status p_new_status) {
 					result = get_parser()->parse_binary(tokens, path);
 				} else {
 					String source = GDScriptCache::get_source_code(remapped_path);
-					source_hash = source.hash();
-					result = get_parser()->parse(source, path, false);
+					Vector<uint8_t> tokens = GDScriptCache::get_cached_binary_tokens(remapped_path, source);
+					if (!tokens.is_empty()) {
+						source_hash = hash_djb2_buffer(tokens.ptr(), tokens.size());
+						result = get_parser()->parse_binary(tokens, path);
+					} else {
+						source_hash = source.hash();
+						result = get_parser()->parse(source, path, false);
+					}
 				}
 			} break;
 			case PARSED: {
@@ -295,6 +309,67 @@ Vector<uint8_t> GDScriptCache::get_binary_tokens(const String &p_path) {
 	return buffer;
 }
 
+Vector<uint8_t> GDScriptCache::get_cached_binary_tokens(const String &p_path, const String &p_source) {
+	if (singleton == nullptr || !singleton->use_tokens_cache || p_source.is_empty() || !p_path.begins_with("res://")) {
+		return Vector<uint8_t>();
+	}
+
+	// Magic, tokenizer version, MD5 of the UTF-8 source and size of the tokens.
+	static const uint8_t magic[4] = { 'G', 'D', 'T', 'C' };
+	static const int header_size = 28;
+
+	const CharString source_utf8 = p_source.utf8();
+	uint8_t source_md5[16];
+	CryptoCore::md5((const uint8_t *)source_utf8.get_data(), source_utf8.length(), source_md5);
+
+	const String cache_path = singleton->tokens_cache_dir.path_join(p_path.md5_text() + ".gdt");
+
+	Ref<FileAccess> f = FileAccess::open(cache_path, FileAccess::READ);
+	if (f.is_valid() && f->get_length() > (uint64_t)header_size) {
+		uint8_t header[header_size];
+		f->get_buffer(header, header_size);
+		if (memcmp(header, magic, 4) == 0 && decode_uint32(&header[4]) == GDScriptTokenizerBuffer::TOKENIZER_VERSION && memcmp(&header[8], source_md5, 16) == 0 && decode_uint32(&header[24]) == f->get_length() - header_size) {
+			Vector<uint8_t> tokens;
+			tokens.resize(f->get_length() - header_size);
+			if (f->get_buffer(tokens.ptrw(), tokens.size()) == (uint64_t)tokens.size()) {
+				return tokens;
+			}
+		}
+	}
+	f.unref();
+
+	Vector<uint8_t> tokens = GDScriptTokenizerBuffer::parse_code_string(p_source, GDScriptTokenizerBuffer::COMPRESS_NONE);
+	if (tokens.is_empty()) {
+		return tokens;
+	}
+
+	// Scripts can be loaded from several threads, so the copy is written to a file of its own and moved
+	// in place, and readers never see a partial one. Failing to write it is not an error, the tokens are
+	// still valid for this run.
+	if (DirAccess::make_dir_recursive_absolute(singleton->tokens_cache_dir) != OK) {
+		return tokens;
+	}
+	const String temp_path = cache_path + "." + itos(Thread::get_caller_id()) + ".tmp";
+	f = FileAccess::open(temp_path, FileAccess::WRITE);
+	if (f.is_null()) {
+		return tokens;
+	}
+	f->store_buffer(magic, 4);
+	f->store_32(GDScriptTokenizerBuffer::TOKENIZER_VERSION);
+	f->store_buffer(source_md5, 16);
+	f->store_32(tokens.size());
+	f->store_buffer(tokens);
+	const bool written = f->get_error() == OK;
+	f.unref();
+
+	Ref<DirAccess> da = DirAccess::create_for_path(temp_path);
+	if (!written || da->rename(temp_path, cache_path) != OK) {
+		da->remove(temp_path);
+	}
+
+	return tokens;
+}
+
 Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_error, const String &p_owner) {
 	MutexLock lock(singleton->mutex);
 
@@ -497,6 +572,10 @@ void GDScriptCache::clear() {
 
 GDScriptCache::GDScriptCache() {
 	singleton = this;
+
+	// The tokenized form drops comments, which the editor needs for documentation. Exported projects already ship tokenized scripts.
+	use_tokens_cache = bool(GLOBAL_GET("debug/settings/gdscript/cache_tokenized_scripts")) && !Engine::get_singleton()->is_editor_hint() && !OS::get_singleton()->has_feature("template");
+	tokens_cache_dir = ProjectSettings::get_singleton()->get_project_data_path().path_join("gdscript_cache");
 }
 
 GDScriptCache::~GDScriptCache() {
@@ -104,6 +104,8 @@ class GDScriptCache {
 	static GDScriptCache *singleton;
 
 	bool cleared = false;
+	bool use_tokens_cache = false;
+	String tokens_cache_dir;
 
 public:
 	static const int BINARY_MUTEX_TAG = 2;
@@ -120,6 +122,13 @@ public:
 	static void remove_parser(const String &p_path);
 	static String get_source_code(const String &p_path);
 	static Vector<uint8_t> get_binary_tokens(const String &p_path);
+	/**
+	 * Returns the binary tokens for a text script, reusing the on-disk copy in the project data
+	 * folder if it was made from the same source, and writing it otherwise.
+	 *
+	 * Returns an empty buffer when the tokens cache is disabled.
+	 */
+	static Vector<uint8_t> get_cached_binary_tokens(const String &p_path, const String &p_source);
 	static Ref<GDScript> get_shallow_script(const String &p_path, Error &r_error, const String &p_owner = String());
 	/**
 	 * Returns a fully loaded GDScript using an already cached script if one exists.
@@ -33,6 +33,11 @@
 #include "gdscript_test_runner.h"
 
 #include "modules/gdscript/gdscript_cache.h"
+#include "modules/gdscript/gdscript_parser.h"
+#include "modules/gdscript/gdscript_tokenizer_buffer.h"
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -47,6 +52,19 @@ public:
 	static bool has_full(String p_path) {
 		return GDScriptCache::singleton->full_gdscript_cache.has(p_path);
 	}
+
+	static void set_tokens_cache(bool p_enabled, const String &p_dir) {
+		GDScriptCache::singleton->use_tokens_cache = p_enabled;
+		GDScriptCache::singleton->tokens_cache_dir = p_dir;
+	}
+
+	static bool is_tokens_cache_enabled() {
+		return GDScriptCache::singleton->use_tokens_cache;
+	}
+
+	static String get_tokens_cache_dir() {
+		return GDScriptCache::singleton->tokens_cache_dir;
+	}
 };
 
 // TODO: Handle some cases failing on release builds. See: https://github.com/godotengine/godot/pull/88452
@@ -105,6 +123,58 @@ TEST_CASE("[Modules][GDScript] Loading keeps ResourceCache and GDScriptCache in
 	CHECK(TestGDScriptCacheAccessor::has_full(path));
 }
 
+TEST_CASE("[Modules][GDScript] Tokenized scripts cache") {
+	const bool was_enabled = TestGDScriptCacheAccessor::is_tokens_cache_enabled();
+	const String previous_dir = TestGDScriptCacheAccessor::get_tokens_cache_dir();
+	const String cache_dir = TestUtils::get_temp_path("gdscript_tokens_cache");
+	const String path = "res://tokens_cache_test.gd";
+	const String cache_path = cache_dir.path_join(path.md5_text() + ".gdt");
+	const String source = "extends RefCounted\n\n# Comments are dropped.\nfunc test():\n\treturn 42\n";
+
+	TestGDScriptCacheAccessor::set_tokens_cache(false, cache_dir);
+	CHECK_MESSAGE(GDScriptCache::get_cached_binary_tokens(path, source).is_empty(), "Nothing should be cached while the cache is disabled.");
+	CHECK_FALSE(FileAccess::exists(cache_path));
+
+	TestGDScriptCacheAccessor::set_tokens_cache(true, cache_dir);
+	const Vector<uint8_t> expected = GDScriptTokenizerBuffer::parse_code_string(source, GDScriptTokenizerBuffer::COMPRESS_NONE);
+
+	Vector<uint8_t> tokens = GDScriptCache::get_cached_binary_tokens(path, source);
+	CHECK(tokens == expected);
+	REQUIRE(FileAccess::exists(cache_path));
+	const uint64_t modified_time = FileAccess::get_modified_time(cache_path);
+
+	SUBCASE("Unchanged source reuses the cached tokens") {
+		tokens = GDScriptCache::get_cached_binary_tokens(path, source);
+		CHECK(tokens == expected);
+		CHECK(FileAccess::get_modified_time(cache_path) == modified_time);
+
+		GDScriptParser parser;
+		CHECK(parser.parse_binary(tokens, path) == OK);
+	}
+
+	SUBCASE("Changed source replaces the cached tokens") {
+		const String changed = source.replace("42", "43");
+		tokens = GDScriptCache::get_cached_binary_tokens(path, changed);
+		CHECK(tokens == GDScriptTokenizerBuffer::parse_code_string(changed, GDScriptTokenizerBuffer::COMPRESS_NONE));
+		CHECK(GDScriptCache::get_cached_binary_tokens(path, source) == expected);
+	}
+
+	SUBCASE("Truncated cache file is regenerated") {
+		const Vector<uint8_t> cached = FileAccess::get_file_as_bytes(cache_path);
+		Ref<FileAccess> f = FileAccess::open(cache_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer(cached.ptr(), cached.size() - 4);
+		f.unref();
+
+		CHECK(GDScriptCache::get_cached_binary_tokens(path, source) == expected);
+		CHECK(FileAccess::get_file_as_bytes(cache_path) == cached);
+	}
+
+	DirAccess::remove_absolute(cache_path);
+	DirAccess::remove_absolute(cache_dir);
+	TestGDScriptCacheAccessor::set_tokens_cache(was_enabled, previous_dir);
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
@@ -0,0 +1,32 @@
+# Validated operators are fused with the assignment or branch consuming their result.
+
+func test():
+	var i := 0
+	var total := 0
+	while i < 5:
+		total += i
+		i += 1
+	print(total)
+
+	var f := 1.5
+	if f * 2.0 > 2.5:
+		print("greater")
+	else:
+		print("not greater")
+
+	var a := 3
+	var b := 3
+	if a - b:
+		print("non-zero")
+	else:
+		print("zero")
+
+	var v := Vector2(1, 2)
+	var w := v + Vector2(3, 4)
+	print(w)
+
+	var count := 0
+	for n in 10:
+		if n % 2 == 0 and n > 2:
+			count += 1
+	print(count)
@@ -259,6 +259,14 @@ real_t combine_friction(GodotBody3D *A, GodotBody3D *B) {
 }
 
 bool GodotBodyPair3D::setup(real_t p_step) {
+	GodotCollisionSolver3D::StaticQuery query;
+	if (!begin_setup(p_step, query)) {
+		return false;
+	}
+	return end_setup(GodotCollisionSolver3D::solve_static(query.shape_A, query.transform_A, query.shape_B, query.transform_B, query.result_callback, query.userdata, query.sep_axis));
+}
+
+bool GodotBodyPair3D::begin_setup(real_t p_step, GodotCollisionSolver3D::StaticQuery &r_query) {
 	check_ccd = false;
 
 	if (!A->interacts_with(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self())) {
@@ -285,16 +293,23 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 	const Vector3 &offset_A = A->get_transform().get_origin();
 	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
-	Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
 
 	Transform3D xform_Bu = B->get_transform();
 	xform_Bu.origin -= offset_A;
-	Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
 
-	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
-	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
+	r_query.shape_A = A->get_shape(shape_A);
+	r_query.transform_A = xform_Au * A->get_shape_transform(shape_A);
+	r_query.shape_B = B->get_shape(shape_B);
+	r_query.transform_B = xform_Bu * B->get_shape_transform(shape_B);
+	r_query.result_callback = _contact_added_callback;
+	r_query.userdata = this;
+	r_query.sep_axis = &sep_axis;
 
-	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	return true;
+}
+
+bool GodotBodyPair3D::end_setup(bool p_collided) {
+	collided = p_collided;
 
 	if (!collided) {
 		if (A->is_continuous_collision_detection_enabled() && collide_A) {
@@ -105,6 +105,8 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 
 public:
 	virtual bool setup(real_t p_step) override;
+	virtual bool begin_setup(real_t p_step, GodotCollisionSolver3D::StaticQuery &r_query) override;
+	virtual bool end_setup(bool p_collided) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
@@ -64,6 +64,7 @@ public:
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) = 0;
 
 	virtual void update() = 0;
+	virtual void set_multithreaded(bool p_enable) {}
 
 	virtual ~GodotBroadPhase3D() {}
 };
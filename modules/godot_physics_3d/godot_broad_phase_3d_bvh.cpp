@@ -32,6 +32,8 @@
 
 #include "godot_collision_object_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 GodotBroadPhase3DBVH::ID GodotBroadPhase3DBVH::create(GodotCollisionObject3D *p_object, int p_subindex, const AABB &p_aabb, bool p_static) {
 	uint32_t tree_id = p_static ? TREE_STATIC : TREE_DYNAMIC;
 	uint32_t tree_collision_mask = p_static ? TREE_FLAG_DYNAMIC : (TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC);
@@ -114,8 +116,38 @@ void GodotBroadPhase3DBVH::set_unpair_callback(UnpairCallback p_unpair_callback,
 	unpair_userdata = p_userdata;
 }
 
+void GodotBroadPhase3DBVH::_gather_pair_candidates(uint32_t p_range, void *p_userdata) {
+	const uint32_t from = p_range * PAIRING_RANGE_SIZE;
+	const uint32_t to = MIN(from + PAIRING_RANGE_SIZE, bvh.get_changed_item_count());
+
+	LocalVector<BVH::PairCandidate> &candidates = pair_candidates[p_range];
+	candidates.clear();
+	bvh.gather_pair_candidates(from, to, candidates);
+}
+
 void GodotBroadPhase3DBVH::update() {
-	bvh.update();
+	if (!multithreaded) {
+		bvh.update();
+		return;
+	}
+
+	bvh.update_tree();
+
+	const uint32_t changed_item_count = bvh.get_changed_item_count();
+	if (changed_item_count < PAIRING_MIN_THREADED_ITEMS) {
+		bvh.update_collisions();
+		return;
+	}
+
+	const uint32_t range_count = Math::division_round_up(changed_item_count, PAIRING_RANGE_SIZE);
+	if (pair_candidates.size() < range_count) {
+		pair_candidates.resize(range_count);
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotBroadPhase3DBVH::_gather_pair_candidates, nullptr, range_count, -1, true, SNAME("Physics3DBroadphasePairing"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	bvh.apply_pair_candidates(pair_candidates.ptr(), PAIRING_RANGE_SIZE);
 }
 
 GodotBroadPhase3D *GodotBroadPhase3DBVH::_create() {
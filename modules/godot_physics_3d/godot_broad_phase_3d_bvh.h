@@ -62,7 +62,19 @@ class GodotBroadPhase3DBVH : public GodotBroadPhase3D {
 		TREE_FLAG_DYNAMIC = 1 << TREE_DYNAMIC,
 	};
 
-	BVH_Manager<GodotCollisionObject3D, 2, true, 128, UserPairTestFunction<GodotCollisionObject3D>, UserCullTestFunction<GodotCollisionObject3D>> bvh;
+	typedef BVH_Manager<GodotCollisionObject3D, 2, true, 128, UserPairTestFunction<GodotCollisionObject3D>, UserCullTestFunction<GodotCollisionObject3D>> BVH;
+	BVH bvh;
+
+	// Changed items are split into fixed size ranges, whose pair candidates are culled
+	// on the WorkerThreadPool. Pairing results are the same as when culling serially.
+	static constexpr uint32_t PAIRING_RANGE_SIZE = 64;
+	// Below this, gathering on threads costs more than it saves.
+	static constexpr uint32_t PAIRING_MIN_THREADED_ITEMS = PAIRING_RANGE_SIZE * 4;
+
+	bool multithreaded = false;
+	LocalVector<LocalVector<BVH::PairCandidate>> pair_candidates;
+
+	void _gather_pair_candidates(uint32_t p_range, void *p_userdata);
 
 	static void *_pair_callback(void *, uint32_t, GodotCollisionObject3D *, int, uint32_t, GodotCollisionObject3D *, int);
 	static void _unpair_callback(void *, uint32_t, GodotCollisionObject3D *, int, uint32_t, GodotCollisionObject3D *, int, void *);
@@ -91,6 +103,7 @@ public:
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) override;
 
 	virtual void update() override;
+	virtual void set_multithreaded(bool p_enable) override { multithreaded = p_enable; }
 
 	static GodotBroadPhase3D *_create();
 	GodotBroadPhase3DBVH();
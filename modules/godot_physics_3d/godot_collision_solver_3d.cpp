@@ -433,6 +433,45 @@ bool GodotCollisionSolver3D::solve_static(const GodotShape3D *p_shape_A, const T
 	}
 }
 
+void GodotCollisionSolver3D::solve_static_batch(StaticQuery *p_queries, int p_query_count) {
+	StaticQuery *sphere_box[STATIC_QUERY_BATCH_SIZE];
+	int sphere_box_count = 0;
+	StaticQuery *box_capsule[STATIC_QUERY_BATCH_SIZE];
+	int box_capsule_count = 0;
+
+	for (int i = 0; i < p_query_count; i++) {
+		StaticQuery &query = p_queries[i];
+		PhysicsServer3D::ShapeType type_A = query.shape_A->get_type();
+		PhysicsServer3D::ShapeType type_B = query.shape_B->get_type();
+		if (type_A > type_B) {
+			SWAP(type_A, type_B);
+		}
+
+		if (type_A == PhysicsServer3D::SHAPE_SPHERE && type_B == PhysicsServer3D::SHAPE_BOX) {
+			sphere_box[sphere_box_count++] = &query;
+			if (sphere_box_count == STATIC_QUERY_BATCH_SIZE) {
+				sat_calculate_penetration_sphere_box_batch(sphere_box, sphere_box_count);
+				sphere_box_count = 0;
+			}
+		} else if (type_A == PhysicsServer3D::SHAPE_BOX && type_B == PhysicsServer3D::SHAPE_CAPSULE) {
+			box_capsule[box_capsule_count++] = &query;
+			if (box_capsule_count == STATIC_QUERY_BATCH_SIZE) {
+				sat_calculate_penetration_box_capsule_batch(box_capsule, box_capsule_count);
+				box_capsule_count = 0;
+			}
+		} else {
+			query.collided = solve_static(query.shape_A, query.transform_A, query.shape_B, query.transform_B, query.result_callback, query.userdata, query.sep_axis);
+		}
+	}
+
+	if (sphere_box_count > 0) {
+		sat_calculate_penetration_sphere_box_batch(sphere_box, sphere_box_count);
+	}
+	if (box_capsule_count > 0) {
+		sat_calculate_penetration_box_capsule_batch(box_capsule, box_capsule_count);
+	}
+}
+
 bool GodotCollisionSolver3D::concave_distance_callback(void *p_userdata, GodotShape3D *p_convex) {
 	_ConcaveCollisionInfo &cinfo = *(static_cast<_ConcaveCollisionInfo *>(p_userdata));
 	cinfo.aabb_tests++;
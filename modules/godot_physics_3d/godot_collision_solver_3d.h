@@ -36,6 +36,20 @@ class GodotCollisionSolver3D {
 public:
 	typedef void (*CallbackResult)(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
+	// Pairs of the same shape types are solved this many at a time by solve_static_batch().
+	static constexpr int STATIC_QUERY_BATCH_SIZE = 8;
+
+	struct StaticQuery {
+		const GodotShape3D *shape_A = nullptr;
+		Transform3D transform_A;
+		const GodotShape3D *shape_B = nullptr;
+		Transform3D transform_B;
+		CallbackResult result_callback = nullptr;
+		void *userdata = nullptr;
+		Vector3 *sep_axis = nullptr;
+		bool collided = false;
+	};
+
 private:
 	static bool soft_body_query_callback(uint32_t p_node_index, void *p_userdata);
 	static void soft_body_contact_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
@@ -50,5 +64,8 @@ private:
 
 public:
 	static bool solve_static(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, CallbackResult p_result_callback, void *p_userdata, Vector3 *r_sep_axis = nullptr, real_t p_margin_A = 0, real_t p_margin_B = 0);
+	// Same as calling solve_static() without margins on each query, but sphere/box and box/capsule pairs
+	// are gathered and solved together by the batched separating axis tests.
+	static void solve_static_batch(StaticQuery *p_queries, int p_query_count);
 	static bool solve_distance(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, Vector3 &r_point_A, Vector3 &r_point_B, const AABB &p_concave_hint, Vector3 *r_sep_axis = nullptr);
 };
@@ -689,6 +689,12 @@ public:
 		return true;
 	}
 
+	// Used by the batched tests, which run the axis tests themselves and only generate the contacts here.
+	_FORCE_INLINE_ void set_best_axis(const Vector3 &p_axis, real_t p_depth) {
+		best_axis = p_axis;
+		best_depth = p_depth;
+	}
+
 	static _FORCE_INLINE_ void test_contact_points(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata) {
 		SeparatorAxisTest<ShapeA, ShapeB, withMargin> *separator = (SeparatorAxisTest<ShapeA, ShapeB, withMargin> *)p_userdata;
 		Vector3 axis = (p_point_B - p_point_A);
@@ -2291,6 +2297,474 @@ static void _collision_convex_polygon_face(const GodotShape3D *p_a, const Transf
 	separator.generate_contacts();
 }
 
+/****** BATCHED SAT TESTS *******/
+
+// The batched tests keep one value per pair of the batch in each array, so that every step runs over
+// the whole batch at once and is vectorized by the compiler. The loops over the batch are kept free of
+// branches for this reason. Unused lanes repeat the first pair and their results are ignored. Each step
+// computes the same values as the scalar tests above.
+
+static constexpr int SAT_BATCH_SIZE = GodotCollisionSolver3D::STATIC_QUERY_BATCH_SIZE;
+
+struct _SoAVector3 {
+	real_t x[SAT_BATCH_SIZE];
+	real_t y[SAT_BATCH_SIZE];
+	real_t z[SAT_BATCH_SIZE];
+
+	_FORCE_INLINE_ void set(int p_lane, const Vector3 &p_value) {
+		x[p_lane] = p_value.x;
+		y[p_lane] = p_value.y;
+		z[p_lane] = p_value.z;
+	}
+
+	_FORCE_INLINE_ Vector3 get(int p_lane) const {
+		return Vector3(x[p_lane], y[p_lane], z[p_lane]);
+	}
+
+	// Vector3::normalize(). Zero vectors are divided by one and then masked out, as selecting between
+	// the square root and a constant would be compiled as a branch.
+	_FORCE_INLINE_ void normalize() {
+		for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+			const real_t lengthsq = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+			const real_t zero = (lengthsq == 0) ? real_t(1) : real_t(0);
+			const real_t divisor = Math::sqrt(lengthsq) + zero;
+			x[i] = x[i] / divisor * (1 - zero);
+			y[i] = y[i] / divisor * (1 - zero);
+			z[i] = z[i] / divisor * (1 - zero);
+		}
+	}
+};
+
+struct _SoATransform3D {
+	_SoAVector3 rows[3];
+	_SoAVector3 origin;
+
+	_FORCE_INLINE_ void set(int p_lane, const Transform3D &p_transform) {
+		for (int r = 0; r < 3; r++) {
+			rows[r].set(p_lane, p_transform.basis.rows[r]);
+		}
+		origin.set(p_lane, p_transform.origin);
+	}
+
+	// Basis::get_column().
+	_FORCE_INLINE_ void get_column(int p_column, _SoAVector3 &r_column) const {
+		for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+			r_column.x[i] = rows[0].get(i)[p_column];
+			r_column.y[i] = rows[1].get(i)[p_column];
+			r_column.z[i] = rows[2].get(i)[p_column];
+		}
+	}
+};
+
+// One candidate axis for each pair of the batch, and the range of B relative to A along it, as computed
+// by SeparatorAxisTest::test_axis().
+struct _SoAAxis {
+	_SoAVector3 axis;
+	real_t min_B[SAT_BATCH_SIZE];
+	real_t max_B[SAT_BATCH_SIZE];
+	bool skip[SAT_BATCH_SIZE];
+};
+
+// Separating axis test state of each pair of the batch.
+struct _SoASeparation {
+	bool separated[SAT_BATCH_SIZE];
+	real_t best_depth[SAT_BATCH_SIZE];
+	Vector3 best_axis[SAT_BATCH_SIZE];
+
+	// Applies the axes in order, like successive calls to SeparatorAxisTest::test_axis().
+	// Returns true once every pair of the batch is separated.
+	bool apply(const _SoAAxis *p_axes, int p_axis_count) {
+		bool all_separated = true;
+		for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+			for (int a = 0; a < p_axis_count && !separated[i]; a++) {
+				const _SoAAxis &axis = p_axes[a];
+				if (axis.skip[i]) {
+					continue;
+				}
+
+				real_t min_B = axis.min_B[i];
+				real_t max_B = axis.max_B[i];
+				if (min_B > 0.0 || max_B < 0.0) {
+					separated[i] = true;
+					break;
+				}
+
+				if (min_B < 0.0) { // could be +0.0, we don't want it to become -0.0
+					min_B = -min_B;
+				}
+
+				if (max_B < min_B) {
+					if (max_B < best_depth[i]) {
+						best_depth[i] = max_B;
+						best_axis[i] = axis.axis.get(i);
+					}
+				} else {
+					if (min_B < best_depth[i]) {
+						best_depth[i] = min_B;
+						best_axis[i] = -axis.axis.get(i); // keep it as A axis
+					}
+				}
+			}
+			all_separated = all_separated && separated[i];
+		}
+		return all_separated;
+	}
+};
+
+struct _SoABoxCapsule {
+	_SoATransform3D transform_A;
+	_SoATransform3D transform_B;
+	_SoAVector3 half_extents_A;
+	real_t radius_B[SAT_BATCH_SIZE];
+	real_t half_segment_B[SAT_BATCH_SIZE]; // height * 0.5 - radius
+
+	// GodotBoxShape3D::project_range() and GodotCapsuleShape3D::project_range() along each axis.
+	// Kept out of line, inlining it at every stage bloats the kernel enough to make it slower.
+	_NO_INLINE_ void project(_SoAAxis &r_axis) const {
+		_SoAVector3 &axis = r_axis.axis;
+		const _SoAVector3 *rows_A = transform_A.rows;
+		const _SoAVector3 *rows_B = transform_B.rows;
+
+		for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+			// Strange case, try an upwards separator.
+			const bool zero_axis = Math::is_zero_approx(axis.x[i]) & Math::is_zero_approx(axis.y[i]) & Math::is_zero_approx(axis.z[i]);
+			const real_t ax = zero_axis ? real_t(0) : axis.x[i];
+			const real_t ay = zero_axis ? real_t(1) : axis.y[i];
+			const real_t az = zero_axis ? real_t(0) : axis.z[i];
+			axis.x[i] = ax;
+			axis.y[i] = ay;
+			axis.z[i] = az;
+
+			const real_t local_x = (rows_A[0].x[i] * ax) + (rows_A[1].x[i] * ay) + (rows_A[2].x[i] * az);
+			const real_t local_y = (rows_A[0].y[i] * ax) + (rows_A[1].y[i] * ay) + (rows_A[2].y[i] * az);
+			const real_t local_z = (rows_A[0].z[i] * ax) + (rows_A[1].z[i] * ay) + (rows_A[2].z[i] * az);
+			const real_t length = Math::abs(local_x) * half_extents_A.x[i] + Math::abs(local_y) * half_extents_A.y[i] + Math::abs(local_z) * half_extents_A.z[i];
+			const real_t distance = ax * transform_A.origin.x[i] + ay * transform_A.origin.y[i] + az * transform_A.origin.z[i];
+			const real_t min_A = distance - length;
+			const real_t max_A = distance + length;
+
+			real_t nx = (rows_B[0].x[i] * ax) + (rows_B[1].x[i] * ay) + (rows_B[2].x[i] * az);
+			real_t ny = (rows_B[0].y[i] * ax) + (rows_B[1].y[i] * ay) + (rows_B[2].y[i] * az);
+			real_t nz = (rows_B[0].z[i] * ax) + (rows_B[1].z[i] * ay) + (rows_B[2].z[i] * az);
+			const real_t lengthsq = nx * nx + ny * ny + nz * nz;
+			const real_t zero = (lengthsq == 0) ? real_t(1) : real_t(0);
+			const real_t divisor = Math::sqrt(lengthsq) + zero;
+			nx = nx / divisor * (1 - zero) * radius_B[i];
+			ny = ny / divisor * (1 - zero) * radius_B[i];
+			nz = nz / divisor * (1 - zero) * radius_B[i];
+			ny += (ny > 0) ? half_segment_B[i] : -half_segment_B[i];
+
+			const real_t max_x = rows_B[0].x[i] * nx + rows_B[0].y[i] * ny + rows_B[0].z[i] * nz + transform_B.origin.x[i];
+			const real_t max_y = rows_B[1].x[i] * nx + rows_B[1].y[i] * ny + rows_B[1].z[i] * nz + transform_B.origin.y[i];
+			const real_t max_z = rows_B[2].x[i] * nx + rows_B[2].y[i] * ny + rows_B[2].z[i] * nz + transform_B.origin.z[i];
+			const real_t min_x = rows_B[0].x[i] * -nx + rows_B[0].y[i] * -ny + rows_B[0].z[i] * -nz + transform_B.origin.x[i];
+			const real_t min_y = rows_B[1].x[i] * -nx + rows_B[1].y[i] * -ny + rows_B[1].z[i] * -nz + transform_B.origin.y[i];
+			const real_t min_z = rows_B[2].x[i] * -nx + rows_B[2].y[i] * -ny + rows_B[2].z[i] * -nz + transform_B.origin.z[i];
+			real_t max_B = ax * max_x + ay * max_y + az * max_z;
+			real_t min_B = ax * min_x + ay * min_y + az * min_z;
+
+			min_B -= (max_A - min_A) * real_t(0.5);
+			max_B += (max_A - min_A) * real_t(0.5);
+
+			min_B -= (min_A + max_A) * real_t(0.5);
+			max_B -= (min_A + max_A) * real_t(0.5);
+
+			r_axis.min_B[i] = min_B;
+			r_axis.max_B[i] = max_B;
+		}
+	}
+};
+
+void sat_calculate_penetration_sphere_box_batch(GodotCollisionSolver3D::StaticQuery *const *p_queries, int p_query_count) {
+	ERR_FAIL_COND(p_query_count < 1 || p_query_count > SAT_BATCH_SIZE);
+
+	// Same as _collision_sphere_box(), with the sphere as A.
+	bool swap[SAT_BATCH_SIZE];
+	_SoATransform3D transform_A;
+	_SoATransform3D transform_B;
+	_SoAVector3 half_extents_B;
+	real_t radius_A[SAT_BATCH_SIZE];
+
+	for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+		const GodotCollisionSolver3D::StaticQuery &query = *p_queries[i < p_query_count ? i : 0];
+		swap[i] = query.shape_A->get_type() != PhysicsServer3D::SHAPE_SPHERE;
+		const GodotSphereShape3D *sphere = static_cast<const GodotSphereShape3D *>(swap[i] ? query.shape_B : query.shape_A);
+		const GodotBoxShape3D *box = static_cast<const GodotBoxShape3D *>(swap[i] ? query.shape_A : query.shape_B);
+		transform_A.set(i, swap[i] ? query.transform_B : query.transform_A);
+		transform_B.set(i, swap[i] ? query.transform_A : query.transform_B);
+		half_extents_B.set(i, box->get_half_extents());
+		radius_A[i] = sphere->get_radius();
+	}
+
+	// Find the point on each box nearest to the center of its sphere.
+	_SoAVector3 nearest;
+	real_t length[SAT_BATCH_SIZE];
+	real_t radius[SAT_BATCH_SIZE];
+	const _SoAVector3 *rows = transform_B.rows;
+	for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+		// Basis::invert().
+		const real_t co_0 = rows[1].y[i] * rows[2].z[i] - rows[1].z[i] * rows[2].y[i];
+		const real_t co_1 = rows[1].z[i] * rows[2].x[i] - rows[1].x[i] * rows[2].z[i];
+		const real_t co_2 = rows[1].x[i] * rows[2].y[i] - rows[1].y[i] * rows[2].x[i];
+		const real_t det = rows[0].x[i] * co_0 + rows[0].y[i] * co_1 + rows[0].z[i] * co_2;
+		const real_t s = 1.0f / det;
+		const real_t inv_0x = co_0 * s;
+		const real_t inv_0y = (rows[0].z[i] * rows[2].y[i] - rows[0].y[i] * rows[2].z[i]) * s;
+		const real_t inv_0z = (rows[0].y[i] * rows[1].z[i] - rows[0].z[i] * rows[1].y[i]) * s;
+		const real_t inv_1x = co_1 * s;
+		const real_t inv_1y = (rows[0].x[i] * rows[2].z[i] - rows[0].z[i] * rows[2].x[i]) * s;
+		const real_t inv_1z = (rows[0].z[i] * rows[1].x[i] - rows[0].x[i] * rows[1].z[i]) * s;
+		const real_t inv_2x = co_2 * s;
+		const real_t inv_2y = (rows[0].y[i] * rows[2].x[i] - rows[0].x[i] * rows[2].y[i]) * s;
+		const real_t inv_2z = (rows[0].x[i] * rows[1].y[i] - rows[0].y[i] * rows[1].x[i]) * s;
+
+		// Transform3D::affine_inverse().xform().
+		const real_t ox = -transform_B.origin.x[i];
+		const real_t oy = -transform_B.origin.y[i];
+		const real_t oz = -transform_B.origin.z[i];
+		const real_t px = transform_A.origin.x[i];
+		const real_t py = transform_A.origin.y[i];
+		const real_t pz = transform_A.origin.z[i];
+		const real_t center_x = inv_0x * px + inv_0y * py + inv_0z * pz + (inv_0x * ox + inv_0y * oy + inv_0z * oz);
+		const real_t center_y = inv_1x * px + inv_1y * py + inv_1z * pz + (inv_1x * ox + inv_1y * oy + inv_1z * oz);
+		const real_t center_z = inv_2x * px + inv_2y * py + inv_2z * pz + (inv_2x * ox + inv_2y * oy + inv_2z * oz);
+
+		const real_t local_x = MIN(MAX(center_x, -half_extents_B.x[i]), half_extents_B.x[i]);
+		const real_t local_y = MIN(MAX(center_y, -half_extents_B.y[i]), half_extents_B.y[i]);
+		const real_t local_z = MIN(MAX(center_z, -half_extents_B.z[i]), half_extents_B.z[i]);
+		nearest.x[i] = rows[0].x[i] * local_x + rows[0].y[i] * local_y + rows[0].z[i] * local_z + transform_B.origin.x[i];
+		nearest.y[i] = rows[1].x[i] * local_x + rows[1].y[i] * local_y + rows[1].z[i] * local_z + transform_B.origin.y[i];
+		nearest.z[i] = rows[2].x[i] * local_x + rows[2].y[i] * local_y + rows[2].z[i] * local_z + transform_B.origin.z[i];
+
+		const real_t dx = nearest.x[i] - px;
+		const real_t dy = nearest.y[i] - py;
+		const real_t dz = nearest.z[i] - pz;
+		length[i] = Math::sqrt(dx * dx + dy * dy + dz * dz);
+
+		const _SoAVector3 &scale = transform_A.rows[0];
+		radius[i] = radius_A[i] * Math::sqrt(scale.x[i] * scale.x[i] + scale.y[i] * scale.y[i] + scale.z[i] * scale.z[i]);
+	}
+
+	for (int i = 0; i < p_query_count; i++) {
+		GodotCollisionSolver3D::StaticQuery &query = *p_queries[i];
+		if (length[i] > radius[i]) {
+			query.collided = false;
+			continue;
+		}
+		query.collided = true;
+		if (!query.result_callback) {
+			continue;
+		}
+
+		_CollectorCallback callback;
+		callback.callback = query.result_callback;
+		callback.userdata = query.userdata;
+		callback.swap = swap[i];
+		callback.prev_axis = query.sep_axis;
+
+		const Vector3 origin_A = transform_A.origin.get(i);
+		const Vector3 point_b = nearest.get(i);
+		Vector3 axis;
+		if (length[i] == 0) {
+			// The box passes through the sphere center.  Select an axis based on the box's center.
+			axis = (transform_B.origin.get(i) - point_b).normalized();
+		} else {
+			axis = (point_b - origin_A) / length[i];
+		}
+		const Vector3 point_a = origin_A + radius[i] * axis;
+		callback.call(point_a, point_b, axis);
+	}
+}
+
+void sat_calculate_penetration_box_capsule_batch(GodotCollisionSolver3D::StaticQuery *const *p_queries, int p_query_count) {
+	ERR_FAIL_COND(p_query_count < 1 || p_query_count > SAT_BATCH_SIZE);
+
+	// Same as _collision_box_capsule(), with the box as A.
+	bool swap[SAT_BATCH_SIZE];
+	_SoABoxCapsule pairs;
+	_SoASeparation separation;
+
+	for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+		const GodotCollisionSolver3D::StaticQuery &query = *p_queries[i < p_query_count ? i : 0];
+		swap[i] = query.shape_A->get_type() != PhysicsServer3D::SHAPE_BOX;
+		const GodotBoxShape3D *box = static_cast<const GodotBoxShape3D *>(swap[i] ? query.shape_B : query.shape_A);
+		const GodotCapsuleShape3D *capsule = static_cast<const GodotCapsuleShape3D *>(swap[i] ? query.shape_A : query.shape_B);
+		pairs.transform_A.set(i, swap[i] ? query.transform_B : query.transform_A);
+		pairs.transform_B.set(i, swap[i] ? query.transform_A : query.transform_B);
+		pairs.half_extents_A.set(i, box->get_half_extents());
+		pairs.radius_B[i] = capsule->get_radius();
+		pairs.half_segment_B[i] = capsule->get_height() * 0.5 - capsule->get_radius();
+
+		separation.separated[i] = i >= p_query_count;
+		separation.best_depth[i] = 1e15;
+		separation.best_axis[i] = Vector3();
+	}
+
+	// The axes are tested in the same order as _collision_box_capsule(), a group at a time, and the
+	// following groups are skipped once every pair of the batch is separated.
+	_SoAAxis axes[8];
+
+	// Previous axis.
+	for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+		const Vector3 *prev_axis = p_queries[i < p_query_count ? i : 0]->sep_axis;
+		axes[0].skip[i] = !prev_axis || *prev_axis == Vector3();
+		axes[0].axis.set(i, axes[0].skip[i] ? Vector3(0, 1, 0) : *prev_axis);
+	}
+	pairs.project(axes[0]);
+	bool all_separated = separation.apply(axes, 1);
+
+	_SoAVector3 columns_A[3];
+	for (int c = 0; c < 3; c++) {
+		pairs.transform_A.get_column(c, columns_A[c]);
+	}
+	_SoAVector3 cyl_axis;
+	pairs.transform_B.get_column(1, cyl_axis);
+	cyl_axis.normalize();
+
+	if (!all_separated) {
+		// faces of A
+		for (int c = 0; c < 3; c++) {
+			_SoAAxis &axis = axes[c];
+			axis.axis = columns_A[c];
+			axis.axis.normalize();
+			memset(axis.skip, 0, sizeof(axis.skip));
+			pairs.project(axis);
+		}
+
+		// edges of A, capsule cylinder
+		for (int c = 0; c < 3; c++) {
+			_SoAAxis &axis = axes[3 + c];
+			const _SoAVector3 &box_axis = columns_A[c];
+			for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+				axis.axis.x[i] = (box_axis.y[i] * cyl_axis.z[i]) - (box_axis.z[i] * cyl_axis.y[i]);
+				axis.axis.y[i] = (box_axis.z[i] * cyl_axis.x[i]) - (box_axis.x[i] * cyl_axis.z[i]);
+				axis.axis.z[i] = (box_axis.x[i] * cyl_axis.y[i]) - (box_axis.y[i] * cyl_axis.x[i]);
+				axis.skip[i] = Math::is_zero_approx(axis.axis.x[i] * axis.axis.x[i] + axis.axis.y[i] * axis.axis.y[i] + axis.axis.z[i] * axis.axis.z[i]);
+			}
+			axis.axis.normalize();
+			pairs.project(axis);
+		}
+		all_separated = separation.apply(axes, 6);
+	}
+
+	if (!all_separated) {
+		// points of A, capsule cylinder
+		for (int p = 0; p < 8; p++) {
+			_SoAAxis &axis = axes[p];
+			const real_t sign_x = (p >> 2) * 2 - 1;
+			const real_t sign_y = ((p >> 1) & 1) * 2 - 1;
+			const real_t sign_z = (p & 1) * 2 - 1;
+			for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+				const real_t he_x = pairs.half_extents_A.x[i] * sign_x;
+				const real_t he_y = pairs.half_extents_A.y[i] * sign_y;
+				const real_t he_z = pairs.half_extents_A.z[i] * sign_z;
+				real_t point_x = pairs.transform_A.origin.x[i];
+				real_t point_y = pairs.transform_A.origin.y[i];
+				real_t point_z = pairs.transform_A.origin.z[i];
+				point_x += columns_A[0].x[i] * he_x;
+				point_y += columns_A[0].y[i] * he_x;
+				point_z += columns_A[0].z[i] * he_x;
+				point_x += columns_A[1].x[i] * he_y;
+				point_y += columns_A[1].y[i] * he_y;
+				point_z += columns_A[1].z[i] * he_y;
+				point_x += columns_A[2].x[i] * he_z;
+				point_y += columns_A[2].y[i] * he_z;
+				point_z += columns_A[2].z[i] * he_z;
+
+				// Plane(cyl_axis).project(point).
+				const real_t distance = cyl_axis.x[i] * point_x + cyl_axis.y[i] * point_y + cyl_axis.z[i] * point_z;
+				axis.axis.x[i] = point_x - cyl_axis.x[i] * distance;
+				axis.axis.y[i] = point_y - cyl_axis.y[i] * distance;
+				axis.axis.z[i] = point_z - cyl_axis.z[i] * distance;
+			}
+			axis.axis.normalize();
+			memset(axis.skip, 0, sizeof(axis.skip));
+			pairs.project(axis);
+		}
+		all_separated = separation.apply(axes, 8);
+	}
+
+	if (!all_separated) {
+		// capsule balls, edges of A
+		const _SoAVector3 *rows_A = pairs.transform_A.rows;
+		const _SoAVector3 *rows_B = pairs.transform_B.rows;
+		for (int b = 0; b < 2; b++) {
+			_SoAVector3 &point_axis = axes[b * 4].axis;
+			const real_t side = (b == 0) ? 1 : -1;
+			for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+				const real_t sphere_x = pairs.transform_B.origin.x[i] + side * (rows_B[0].y[i] * pairs.half_segment_B[i]);
+				const real_t sphere_y = pairs.transform_B.origin.y[i] + side * (rows_B[1].y[i] * pairs.half_segment_B[i]);
+				const real_t sphere_z = pairs.transform_B.origin.z[i] + side * (rows_B[2].y[i] * pairs.half_segment_B[i]);
+
+				// The corner of A on the side of the sphere center.
+				const real_t v_x = sphere_x - pairs.transform_A.origin.x[i];
+				const real_t v_y = sphere_y - pairs.transform_A.origin.y[i];
+				const real_t v_z = sphere_z - pairs.transform_A.origin.z[i];
+				const real_t cnormal_x = (rows_A[0].x[i] * v_x) + (rows_A[1].x[i] * v_y) + (rows_A[2].x[i] * v_z);
+				const real_t cnormal_y = (rows_A[0].y[i] * v_x) + (rows_A[1].y[i] * v_y) + (rows_A[2].y[i] * v_z);
+				const real_t cnormal_z = (rows_A[0].z[i] * v_x) + (rows_A[1].z[i] * v_y) + (rows_A[2].z[i] * v_z);
+				const real_t corner_x = (cnormal_x < 0) ? -pairs.half_extents_A.x[i] : pairs.half_extents_A.x[i];
+				const real_t corner_y = (cnormal_y < 0) ? -pairs.half_extents_A.y[i] : pairs.half_extents_A.y[i];
+				const real_t corner_z = (cnormal_z < 0) ? -pairs.half_extents_A.z[i] : pairs.half_extents_A.z[i];
+				const real_t cpoint_x = rows_A[0].x[i] * corner_x + rows_A[0].y[i] * corner_y + rows_A[0].z[i] * corner_z + pairs.transform_A.origin.x[i];
+				const real_t cpoint_y = rows_A[1].x[i] * corner_x + rows_A[1].y[i] * corner_y + rows_A[1].z[i] * corner_z + pairs.transform_A.origin.y[i];
+				const real_t cpoint_z = rows_A[2].x[i] * corner_x + rows_A[2].y[i] * corner_y + rows_A[2].z[i] * corner_z + pairs.transform_A.origin.z[i];
+
+				point_axis.x[i] = sphere_x - cpoint_x;
+				point_axis.y[i] = sphere_y - cpoint_y;
+				point_axis.z[i] = sphere_z - cpoint_z;
+			}
+			point_axis.normalize();
+			memset(axes[b * 4].skip, 0, sizeof(axes[b * 4].skip));
+
+			// test edges of A
+			for (int c = 0; c < 3; c++) {
+				_SoAAxis &axis = axes[b * 4 + 1 + c];
+				const _SoAVector3 &edge = columns_A[c];
+				for (int i = 0; i < SAT_BATCH_SIZE; i++) {
+					const real_t cross_x = (point_axis.y[i] * edge.z[i]) - (point_axis.z[i] * edge.y[i]);
+					const real_t cross_y = (point_axis.z[i] * edge.x[i]) - (point_axis.x[i] * edge.z[i]);
+					const real_t cross_z = (point_axis.x[i] * edge.y[i]) - (point_axis.y[i] * edge.x[i]);
+					axis.axis.x[i] = (cross_y * edge.z[i]) - (cross_z * edge.y[i]);
+					axis.axis.y[i] = (cross_z * edge.x[i]) - (cross_x * edge.z[i]);
+					axis.axis.z[i] = (cross_x * edge.y[i]) - (cross_y * edge.x[i]);
+				}
+				axis.axis.normalize();
+				memset(axis.skip, 0, sizeof(axis.skip));
+			}
+
+			// The point axis is projected after the edge axes are built from it, as projecting replaces
+			// zero axes.
+			for (int a = 0; a < 4; a++) {
+				pairs.project(axes[b * 4 + a]);
+			}
+		}
+		separation.apply(axes, 8);
+	}
+
+	for (int i = 0; i < p_query_count; i++) {
+		GodotCollisionSolver3D::StaticQuery &query = *p_queries[i];
+		if (separation.separated[i]) {
+			query.collided = false;
+			continue;
+		}
+
+		const GodotBoxShape3D *box = static_cast<const GodotBoxShape3D *>(swap[i] ? query.shape_B : query.shape_A);
+		const GodotCapsuleShape3D *capsule = static_cast<const GodotCapsuleShape3D *>(swap[i] ? query.shape_A : query.shape_B);
+
+		_CollectorCallback callback;
+		callback.callback = query.result_callback;
+		callback.userdata = query.userdata;
+		callback.swap = swap[i];
+		callback.prev_axis = query.sep_axis;
+
+		SeparatorAxisTest<GodotBoxShape3D, GodotCapsuleShape3D, false> separator(box, swap[i] ? query.transform_B : query.transform_A, capsule, swap[i] ? query.transform_A : query.transform_B, &callback);
+		separator.set_best_axis(separation.best_axis[i], separation.best_depth[i]);
+		separator.generate_contacts();
+		query.collided = callback.collided;
+	}
+}
+
 bool sat_calculate_penetration(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata, bool p_swap, Vector3 *r_prev_axis, real_t p_margin_a, real_t p_margin_b) {
 	PhysicsServer3D::ShapeType type_A = p_shape_A->get_type();
 
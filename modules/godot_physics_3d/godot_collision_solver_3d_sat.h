@@ -33,3 +33,9 @@
 #include "godot_collision_solver_3d.h"
 
 bool sat_calculate_penetration(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, GodotCollisionSolver3D::CallbackResult p_result_callback, void *p_userdata, bool p_swap = false, Vector3 *r_prev_axis = nullptr, real_t p_margin_a = 0, real_t p_margin_b = 0);
+
+// Batched sat_calculate_penetration() for sphere/box and box/capsule pairs, for up to
+// GodotCollisionSolver3D::STATIC_QUERY_BATCH_SIZE queries without margins. The shapes of a query can be
+// in either order.
+void sat_calculate_penetration_sphere_box_batch(GodotCollisionSolver3D::StaticQuery *const *p_queries, int p_query_count);
+void sat_calculate_penetration_box_capsule_batch(GodotCollisionSolver3D::StaticQuery *const *p_queries, int p_query_count);
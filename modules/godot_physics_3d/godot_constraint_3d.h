@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "godot_collision_solver_3d.h"
+
 #include "core/templates/rid.h"
 #include "core/typedefs.h"
 
@@ -74,6 +76,13 @@ public:
 	_FORCE_INLINE_ bool is_disabled_collisions_between_bodies() const { return disabled_collisions_between_bodies; }
 
 	virtual bool setup(real_t p_step) = 0;
+	// setup() split around its narrowphase query, so that the step can solve the queries of several constraints in a batch.
+	// When this returns true, r_query must be solved and its result passed to end_setup().
+	virtual bool begin_setup(real_t p_step, GodotCollisionSolver3D::StaticQuery &r_query) {
+		setup(p_step);
+		return false;
+	}
+	virtual bool end_setup(bool p_collided) { return p_collided; }
 	virtual bool pre_solve(real_t p_step) = 0;
 	virtual void solve(real_t p_step) = 0;
 
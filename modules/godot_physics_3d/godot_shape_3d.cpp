@@ -249,17 +249,6 @@ real_t GodotSphereShape3D::get_radius() const {
 	return radius;
 }
 
-void GodotSphereShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	real_t d = p_normal.dot(p_transform.origin);
-
-	// figure out scale at point
-	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
-	real_t scale = local_normal.length();
-
-	r_min = d - (radius)*scale;
-	r_max = d + (radius)*scale;
-}
-
 Vector3 GodotSphereShape3D::get_support(const Vector3 &p_normal) const {
 	return p_normal * radius;
 }
@@ -309,17 +298,6 @@ GodotSphereShape3D::GodotSphereShape3D() {}
 
 /********** BOX *************/
 
-void GodotBoxShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	// no matter the angle, the box is mirrored anyway
-	Vector3 local_normal = p_transform.basis.xform_inv(p_normal);
-
-	real_t length = local_normal.abs().dot(half_extents);
-	real_t distance = p_normal.dot(p_transform.origin);
-
-	r_min = distance - length;
-	r_max = distance + length;
-}
-
 Vector3 GodotBoxShape3D::get_support(const Vector3 &p_normal) const {
 	Vector3 point(
 			(p_normal.x < 0) ? -half_extents.x : half_extents.x,
@@ -493,17 +471,6 @@ GodotBoxShape3D::GodotBoxShape3D() {}
 
 /********** CAPSULE *************/
 
-void GodotCapsuleShape3D::project_range(const Vector3 &p_normal, const Transform3D &p_transform, real_t &r_min, real_t &r_max) const {
-	Vector3 n = p_transform.basis.xform_inv(p_normal).normalized();
-	real_t h = height * 0.5 - radius;
-
-	n *= radius;
-	n.y += (n.y > 0) ? h : -h;
-
-	r_max = p_normal.dot(p_transform.xform(n));
-	r_min = p_normal.dot(p_transform.xform(-n));
-}
-
 Vector3 GodotCapsuleShape3D::get_support(const Vector3 &p_normal) const {
 	Vector3 n = p_normal;
 
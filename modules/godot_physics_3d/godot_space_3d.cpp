@@ -1269,6 +1269,7 @@ GodotSpace3D::GodotSpace3D() {
 	broadphase = GodotBroadPhase3D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
 	broadphase->set_unpair_callback(_broadphase_unpair, this);
+	broadphase->set_multithreaded(GLOBAL_GET("physics/3d/multithreaded_broadphase"));
 
 	direct_access = memnew(GodotPhysicsDirectSpaceState3D);
 	direct_access->space = this;
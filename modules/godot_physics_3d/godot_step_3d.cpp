@@ -112,9 +112,26 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
-void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
-	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
-	constraint->setup(delta);
+void GodotStep3D::_setup_constraints(uint32_t p_batch_index, void *p_userdata) {
+	const uint32_t constraint_begin = p_batch_index * CONSTRAINT_SETUP_BATCH_SIZE;
+	const uint32_t constraint_end = MIN(constraint_begin + CONSTRAINT_SETUP_BATCH_SIZE, all_constraints.size());
+
+	GodotCollisionSolver3D::StaticQuery queries[CONSTRAINT_SETUP_BATCH_SIZE];
+	GodotConstraint3D *query_constraints[CONSTRAINT_SETUP_BATCH_SIZE];
+	int query_count = 0;
+
+	for (uint32_t constraint_index = constraint_begin; constraint_index < constraint_end; ++constraint_index) {
+		GodotConstraint3D *constraint = all_constraints[constraint_index];
+		if (constraint->begin_setup(delta, queries[query_count])) {
+			query_constraints[query_count++] = constraint;
+		}
+	}
+
+	GodotCollisionSolver3D::solve_static_batch(queries, query_count);
+
+	for (int query_index = 0; query_index < query_count; ++query_index) {
+		query_constraints[query_index]->end_setup(queries[query_index].collided);
+	}
 }
 
 void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const {
@@ -344,7 +361,8 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	uint32_t constraint_batch_count = (total_constraint_count + CONSTRAINT_SETUP_BATCH_SIZE - 1) / CONSTRAINT_SETUP_BATCH_SIZE;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraints, nullptr, constraint_batch_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
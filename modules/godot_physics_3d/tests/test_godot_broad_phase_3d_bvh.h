@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*  test_godot_broad_phase_3d_bvh.h                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_body_3d.h"
+#include "../godot_broad_phase_3d_bvh.h"
+
+#include "core/math/random_pcg.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotBroadPhase3DBVH {
+
+// Bodies are identified by their subindex, so both broadphases log the same events.
+static void *pair_callback(GodotCollisionObject3D *p_a, int p_subindex_a, GodotCollisionObject3D *p_b, int p_subindex_b, void *p_userdata) {
+	LocalVector<Vector3i> *log = static_cast<LocalVector<Vector3i> *>(p_userdata);
+	log->push_back(Vector3i(1, p_subindex_a, p_subindex_b));
+	return nullptr;
+}
+
+static void unpair_callback(GodotCollisionObject3D *p_a, int p_subindex_a, GodotCollisionObject3D *p_b, int p_subindex_b, void *p_data, void *p_userdata) {
+	LocalVector<Vector3i> *log = static_cast<LocalVector<Vector3i> *>(p_userdata);
+	log->push_back(Vector3i(-1, p_subindex_a, p_subindex_b));
+}
+
+static LocalVector<Vector3i> simulate_pairing(const LocalVector<GodotBody3D *> &p_bodies, bool p_multithreaded) {
+	LocalVector<Vector3i> log;
+
+	GodotBroadPhase3DBVH broad_phase;
+	broad_phase.set_multithreaded(p_multithreaded);
+	broad_phase.set_pair_callback(pair_callback, &log);
+	broad_phase.set_unpair_callback(unpair_callback, &log);
+
+	// Overlapping boxes on a grid, enough of them to take the threaded path.
+	const int side = 8;
+	LocalVector<Vector3> positions;
+	LocalVector<GodotBroadPhase3D::ID> ids;
+	for (uint32_t i = 0; i < p_bodies.size(); i++) {
+		positions.push_back(Vector3(i % side, (i / side) % side, i / (side * side)));
+		ids.push_back(broad_phase.create(p_bodies[i], i, AABB(positions[i], Vector3(1.5, 1.5, 1.5))));
+	}
+	broad_phase.update();
+
+	// Every body moves each step, so pairs keep being made and broken.
+	RandomPCG rng(1234);
+	for (int step = 0; step < 10; step++) {
+		for (uint32_t i = 0; i < ids.size(); i++) {
+			positions[i] += Vector3(rng.random(-0.6f, 0.6f), rng.random(-0.6f, 0.6f), rng.random(-0.6f, 0.6f));
+			broad_phase.move(ids[i], AABB(positions[i], Vector3(1.5, 1.5, 1.5)));
+		}
+		broad_phase.update();
+	}
+
+	for (const GodotBroadPhase3D::ID id : ids) {
+		broad_phase.remove(id);
+	}
+
+	return log;
+}
+
+TEST_CASE("[Physics][BVH] Multithreaded pairing sends the same callbacks") {
+	LocalVector<GodotBody3D *> bodies;
+	for (int i = 0; i < 512; i++) {
+		bodies.push_back(memnew(GodotBody3D));
+	}
+
+	const LocalVector<Vector3i> serial = simulate_pairing(bodies, false);
+	const LocalVector<Vector3i> threaded = simulate_pairing(bodies, true);
+
+	int pairs = 0;
+	int unpairs = 0;
+	for (const Vector3i &event : serial) {
+		(event.x > 0 ? pairs : unpairs)++;
+	}
+	CHECK(pairs > 0);
+	CHECK(unpairs > 0);
+
+	REQUIRE(serial.size() == threaded.size());
+	bool identical = true;
+	for (uint32_t i = 0; i < serial.size(); i++) {
+		if (serial[i] != threaded[i]) {
+			identical = false;
+			break;
+		}
+	}
+	CHECK_MESSAGE(identical, "Pair and unpair callbacks should be sent in the same order with multithreaded pairing.");
+
+	for (GodotBody3D *body : bodies) {
+		memdelete(body);
+	}
+}
+
+} // namespace TestGodotBroadPhase3DBVH
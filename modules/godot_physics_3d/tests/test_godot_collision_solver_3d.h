@@ -0,0 +1,214 @@
+/**************************************************************************/
+/*  test_godot_collision_solver_3d.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "../godot_collision_solver_3d.h"
+#include "../godot_shape_3d.h"
+
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotCollisionSolver3D {
+
+static void contact_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &p_normal, void *p_userdata) {
+	(*static_cast<int *>(p_userdata))++;
+}
+
+// Sweeps the shape across the box's faces, edges and corners.
+static Transform3D sweep_transform(int p_index, int p_count) {
+	const real_t t = real_t(p_index) / p_count;
+	return Transform3D(Basis(Vector3(1, 1, 0).normalized(), t * Math::TAU), Vector3(Math::cos(t * Math::TAU), 1.2 - t * 0.6, Math::sin(t * Math::TAU * 3.0)));
+}
+
+static uint64_t solve_against_box(const GodotShape3D *p_shape, const GodotBoxShape3D *p_box, int p_iterations, int &r_contacts) {
+	const OS *os = OS::get_singleton();
+	const uint64_t begin = os->get_ticks_usec();
+	for (int i = 0; i < p_iterations; i++) {
+		Vector3 sep_axis;
+		GodotCollisionSolver3D::solve_static(p_shape, sweep_transform(i, p_iterations), p_box, Transform3D(), contact_callback, &r_contacts, &sep_axis);
+	}
+	return os->get_ticks_usec() - begin;
+}
+
+static uint64_t solve_against_box_batched(const GodotShape3D *p_shape, const GodotBoxShape3D *p_box, int p_iterations, int &r_contacts) {
+	const int batch_size = GodotCollisionSolver3D::STATIC_QUERY_BATCH_SIZE;
+	GodotCollisionSolver3D::StaticQuery queries[batch_size];
+	Vector3 sep_axes[batch_size];
+
+	const OS *os = OS::get_singleton();
+	const uint64_t begin = os->get_ticks_usec();
+	for (int i = 0; i < p_iterations; i += batch_size) {
+		const int count = MIN(batch_size, p_iterations - i);
+		for (int j = 0; j < count; j++) {
+			GodotCollisionSolver3D::StaticQuery &query = queries[j];
+			sep_axes[j] = Vector3();
+			query.shape_A = p_shape;
+			query.transform_A = sweep_transform(i + j, p_iterations);
+			query.shape_B = p_box;
+			query.transform_B = Transform3D();
+			query.result_callback = contact_callback;
+			query.userdata = &r_contacts;
+			query.sep_axis = &sep_axes[j];
+		}
+		GodotCollisionSolver3D::solve_static_batch(queries, count);
+	}
+	return os->get_ticks_usec() - begin;
+}
+
+struct RecordedContacts {
+	LocalVector<Vector3> points;
+	LocalVector<Vector3> normals;
+};
+
+static void record_contact(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &p_normal, void *p_userdata) {
+	RecordedContacts *contacts = static_cast<RecordedContacts *>(p_userdata);
+	contacts->points.push_back(p_point_A);
+	contacts->points.push_back(p_point_B);
+	contacts->normals.push_back(p_normal);
+}
+
+TEST_CASE("[Physics] Batched separating axis tests match the scalar ones") {
+	GodotBoxShape3D box;
+	box.set_data(Vector3(1, 0.5, 0.75));
+
+	GodotSphereShape3D sphere;
+	sphere.set_data(0.5);
+
+	GodotCapsuleShape3D capsule;
+	Dictionary capsule_data;
+	capsule_data["radius"] = 0.25;
+	capsule_data["height"] = 1.5;
+	capsule.set_data(capsule_data);
+
+	// The sphere/capsule pair is not batched and goes through solve_static().
+	const GodotShape3D *pairs[][2] = {
+		{ &sphere, &box },
+		{ &box, &sphere },
+		{ &box, &capsule },
+		{ &capsule, &box },
+		{ &sphere, &capsule },
+	};
+	const int pair_count = sizeof(pairs) / sizeof(pairs[0]);
+	const int sweep = 256;
+	const Transform3D box_xform(Basis(Vector3(0, 1, 0), 0.3).scaled(Vector3(1, 1.5, 1)), Vector3(0.1, 0, -0.2));
+
+	LocalVector<GodotCollisionSolver3D::StaticQuery> queries;
+	LocalVector<RecordedContacts> batched_contacts;
+	LocalVector<Vector3> batched_sep_axes;
+	queries.resize(sweep * pair_count);
+	batched_contacts.resize(sweep * pair_count);
+	batched_sep_axes.resize(sweep * pair_count);
+
+	LocalVector<RecordedContacts> contacts;
+	LocalVector<Vector3> sep_axes;
+	LocalVector<bool> collided;
+	contacts.resize(sweep * pair_count);
+	sep_axes.resize(sweep * pair_count);
+	collided.resize(sweep * pair_count);
+
+	// The second pass starts from the separating axis of the first one.
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = 0; i < sweep; i++) {
+			for (int p = 0; p < pair_count; p++) {
+				const int index = i * pair_count + p;
+				const bool moving_is_A = pairs[p][1] == &box;
+				const Transform3D moving_xform = sweep_transform(i, sweep);
+
+				GodotCollisionSolver3D::StaticQuery &query = queries[index];
+				query.shape_A = pairs[p][0];
+				query.transform_A = moving_is_A ? moving_xform : box_xform;
+				query.shape_B = pairs[p][1];
+				query.transform_B = moving_is_A ? box_xform : moving_xform;
+				query.result_callback = record_contact;
+				query.userdata = &batched_contacts[index];
+				query.sep_axis = &batched_sep_axes[index];
+				batched_contacts[index] = RecordedContacts();
+				contacts[index] = RecordedContacts();
+
+				collided[index] = GodotCollisionSolver3D::solve_static(query.shape_A, query.transform_A, query.shape_B, query.transform_B, record_contact, &contacts[index], &sep_axes[index]);
+			}
+		}
+
+		GodotCollisionSolver3D::solve_static_batch(queries.ptr(), queries.size());
+
+		int collisions = 0;
+		for (uint32_t i = 0; i < queries.size(); i++) {
+			collisions += collided[i] ? 1 : 0;
+			CHECK(queries[i].collided == collided[i]);
+			CHECK(batched_sep_axes[i].is_equal_approx(sep_axes[i]));
+			REQUIRE(batched_contacts[i].points.size() == contacts[i].points.size());
+			for (uint32_t j = 0; j < contacts[i].points.size(); j++) {
+				CHECK(batched_contacts[i].points[j].is_equal_approx(contacts[i].points[j]));
+			}
+			for (uint32_t j = 0; j < contacts[i].normals.size(); j++) {
+				CHECK(batched_contacts[i].normals[j].is_equal_approx(contacts[i].normals[j]));
+			}
+		}
+		CHECK_MESSAGE(collisions > 0, "The sweep should hit the box.");
+		CHECK_MESSAGE(collisions < int(queries.size()), "The sweep should also miss the box.");
+	}
+}
+
+// Run with `--test --no-skip --test-case="*Benchmark*"`.
+TEST_CASE("[Physics][Benchmark] Separating axis test against boxes" * doctest::skip()) {
+	const int iterations = 1000000;
+
+	GodotBoxShape3D box;
+	box.set_data(Vector3(1, 1, 1));
+
+	GodotSphereShape3D sphere;
+	sphere.set_data(0.5);
+
+	GodotCapsuleShape3D capsule;
+	Dictionary capsule_data;
+	capsule_data["radius"] = 0.25;
+	capsule_data["height"] = 1.5;
+	capsule.set_data(capsule_data);
+
+	int sphere_contacts = 0;
+	const uint64_t sphere_usec = solve_against_box(&sphere, &box, iterations, sphere_contacts);
+	int sphere_batched_contacts = 0;
+	const uint64_t sphere_batched_usec = solve_against_box_batched(&sphere, &box, iterations, sphere_batched_contacts);
+
+	int capsule_contacts = 0;
+	const uint64_t capsule_usec = solve_against_box(&capsule, &box, iterations, capsule_contacts);
+	int capsule_batched_contacts = 0;
+	const uint64_t capsule_batched_usec = solve_against_box_batched(&capsule, &box, iterations, capsule_batched_contacts);
+
+	CHECK(sphere_contacts > 0);
+	CHECK(capsule_contacts > 0);
+	CHECK(sphere_batched_contacts == sphere_contacts);
+	CHECK(capsule_batched_contacts == capsule_contacts);
+	MESSAGE(vformat("%d solves per pair. Sphere vs box: %d ms scalar, %d ms batched (%d contacts). Capsule vs box: %d ms scalar, %d ms batched (%d contacts).", iterations, sphere_usec / 1000, sphere_batched_usec / 1000, sphere_contacts, capsule_usec / 1000, capsule_batched_usec / 1000, capsule_contacts));
+}
+} // namespace TestGodotCollisionSolver3D
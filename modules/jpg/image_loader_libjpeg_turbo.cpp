@@ -81,6 +81,13 @@ Error ImageLoaderLibJPEGTurbo::load_image(Ref<Image> p_image, Ref<FileAccess> f,
 	Vector<uint8_t> src_image;
 	uint64_t src_image_len = f->get_length();
 	ERR_FAIL_COND_V(src_image_len == 0, ERR_FILE_CORRUPT);
+
+	// Decode straight from the file's memory (e.g. a mapped pack) when possible.
+	const Span<uint8_t> view = f->get_buffer_view(src_image_len);
+	if (!view.is_empty()) {
+		return jpeg_turbo_load_image_from_buffer(p_image.ptr(), view.ptr(), view.size());
+	}
+
 	src_image.resize(src_image_len);
 
 	uint8_t *w = src_image.ptrw();
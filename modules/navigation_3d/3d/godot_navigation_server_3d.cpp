@@ -259,6 +259,42 @@ Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origi
 	return query_result->get_path();
 }
 
+Array GodotNavigationServer3D::map_get_paths(RID p_map, const PackedVector3Array &p_origins, const PackedVector3Array &p_destinations, bool p_optimize, uint32_t p_navigation_layers) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, Array());
+	ERR_FAIL_COND_V_MSG(p_origins.size() != p_destinations.size(), Array(), "The origins and destinations arrays must have the same size.");
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_template;
+	query_template.navigation_layers = p_navigation_layers;
+	query_template.metadata_flags = PathMetadataFlags::PATH_INCLUDE_NONE;
+	query_template.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+	query_template.path_postprocessing = p_optimize ? PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL : PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+	query_template.map = map;
+
+	LocalVector<Vector3> path_points;
+	LocalVector<int32_t> path_ends;
+	map->query_path_batch(query_template, p_origins.ptr(), p_destinations.ptr(), p_origins.size(), path_points, path_ends);
+
+	PackedVector3Array points;
+	points.resize(path_points.size());
+	Vector3 *points_ptrw = points.ptrw();
+	for (uint32_t i = 0; i < path_points.size(); i++) {
+		points_ptrw[i] = path_points[i];
+	}
+
+	PackedInt32Array ends;
+	ends.resize(path_ends.size());
+	int32_t *ends_ptrw = ends.ptrw();
+	for (uint32_t i = 0; i < path_ends.size(); i++) {
+		ends_ptrw[i] = path_ends[i];
+	}
+
+	Array result;
+	result.push_back(points);
+	result.push_back(ends);
+	return result;
+}
+
 Vector3 GodotNavigationServer3D::map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	const NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector3());
@@ -37,6 +37,7 @@
 #include "nav_region_iteration_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/templates/hash_set.h"
 
 using namespace Nav3D;
 
@@ -72,6 +73,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_polygon_clusters(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -394,6 +397,122 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_polygon_clusters(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<PolygonCluster> &clusters = map_iteration->clusters;
+	LocalVector<uint32_t> &cluster_connection_offsets = map_iteration->cluster_connection_offsets;
+	LocalVector<uint32_t> &cluster_connections = map_iteration->cluster_connections;
+	LocalVector<uint32_t> &polygon_clusters = map_iteration->polygon_clusters;
+
+	clusters.clear();
+	cluster_connection_offsets.clear();
+	cluster_connections.clear();
+	polygon_clusters.clear();
+
+	// The regions cluster their own polygons when they are rebuilt, so here only the
+	// cluster lists are joined and the connections between regions are added.
+	bool has_polygons = false;
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		if (!region->has_clusters()) {
+			return;
+		}
+		has_polygons = has_polygons || !region->navmesh_polygons.is_empty();
+	}
+	if (!has_polygons) {
+		return;
+	}
+
+	HashMap<const NavBaseIteration3D *, uint32_t> navbase_cluster_offsets;
+	LocalVector<ClusterEdge> cluster_edges;
+
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		const uint32_t cluster_offset = clusters.size();
+		navbase_cluster_offsets[region.ptr()] = cluster_offset;
+
+		for (const Vector3 &cluster_position : region->cluster_positions) {
+			PolygonCluster cluster;
+			cluster.owner = region.ptr();
+			cluster.position = cluster_position;
+			clusters.push_back(cluster);
+		}
+
+		for (uint32_t polygon_cluster : region->polygon_clusters) {
+			polygon_clusters.push_back(cluster_offset + polygon_cluster);
+		}
+
+		for (const ClusterEdge &region_cluster_edge : region->cluster_edges) {
+			ClusterEdge cluster_edge;
+			cluster_edge.from = cluster_offset + region_cluster_edge.from;
+			cluster_edge.to = cluster_offset + region_cluster_edge.to;
+			cluster_edges.push_back(cluster_edge);
+		}
+	}
+
+	// Each link polygon is a cluster of its own.
+	for (const Polygon &link_polygon : map_iteration->navlink_polygons) {
+		navbase_cluster_offsets[link_polygon.owner] = clusters.size();
+		polygon_clusters.push_back(clusters.size());
+
+		PolygonCluster cluster;
+		cluster.owner = link_polygon.owner;
+		if (link_polygon.vertices.size() == 4) {
+			cluster.position = (link_polygon.vertices[0] + link_polygon.vertices[2]) * 0.5;
+		}
+		clusters.push_back(cluster);
+	}
+
+	HashSet<uint64_t> external_edge_keys;
+	for (const KeyValue<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &navbase_it : map_iteration->navbases_polygons_external_connections) {
+		const NavBaseIteration3D *navbase = navbase_it.key;
+		const bool navbase_is_region = navbase->get_type() == NavigationEnums3D::PathSegmentType::PATH_SEGMENT_TYPE_REGION;
+		const uint32_t navbase_cluster_offset = navbase_cluster_offsets[navbase];
+
+		for (uint32_t polygon_index = 0; polygon_index < navbase_it.value.size(); polygon_index++) {
+			const uint32_t from = navbase_is_region ? navbase_cluster_offset + static_cast<const NavRegionIteration3D *>(navbase)->polygon_clusters[polygon_index] : navbase_cluster_offset;
+
+			for (const Connection &connection : navbase_it.value[polygon_index]) {
+				const NavBaseIteration3D *connection_owner = connection.polygon->owner;
+				uint32_t to = navbase_cluster_offsets[connection_owner];
+				if (connection_owner->get_type() == NavigationEnums3D::PathSegmentType::PATH_SEGMENT_TYPE_REGION) {
+					to += static_cast<const NavRegionIteration3D *>(connection_owner)->polygon_clusters[connection.polygon->id];
+				}
+
+				const uint64_t edge_key = (uint64_t(from) << 32) | to;
+				if (from != to && !external_edge_keys.has(edge_key)) {
+					external_edge_keys.insert(edge_key);
+					ClusterEdge cluster_edge;
+					cluster_edge.from = from;
+					cluster_edge.to = to;
+					cluster_edges.push_back(cluster_edge);
+				}
+			}
+		}
+	}
+
+	// Store the connections grouped by their source cluster.
+	cluster_connection_offsets.resize(clusters.size() + 1);
+	for (uint32_t &cluster_connection_offset : cluster_connection_offsets) {
+		cluster_connection_offset = 0;
+	}
+	for (const ClusterEdge &cluster_edge : cluster_edges) {
+		cluster_connection_offsets[cluster_edge.from + 1]++;
+	}
+	for (uint32_t i = 1; i < cluster_connection_offsets.size(); i++) {
+		cluster_connection_offsets[i] += cluster_connection_offsets[i - 1];
+	}
+
+	LocalVector<uint32_t> cluster_connection_counts;
+	cluster_connection_counts.resize(clusters.size());
+	for (uint32_t &cluster_connection_count : cluster_connection_counts) {
+		cluster_connection_count = 0;
+	}
+	cluster_connections.resize(cluster_edges.size());
+	for (const ClusterEdge &cluster_edge : cluster_edges) {
+		cluster_connections[cluster_connection_offsets[cluster_edge.from] + cluster_connection_counts[cluster_edge.from]++] = cluster_edge.to;
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -409,6 +528,16 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		p_path_query_slot.path_corridor.clear();
 
 		p_path_query_slot.path_corridor.resize(total_polygon_count);
+		for (NavigationPoly &navigation_poly : p_path_query_slot.path_corridor) {
+			navigation_poly.reset();
+		}
+		p_path_query_slot.path_corridor_touched_ids.clear();
+
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.cluster_corridor.clear();
+		p_path_query_slot.cluster_corridor.resize(map_iteration->clusters.size());
+		p_path_query_slot.cluster_search_id = 0;
+		p_path_query_slot.corridor_polygon_clusters = nullptr;
 
 		p_path_query_slot.poly_to_id.clear();
 		p_path_query_slot.poly_to_id.reserve(total_polygon_count);
@@ -89,6 +89,14 @@ struct NavMapIteration3D {
 
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
+	// Coarse graph of polygon clusters searched before the polygons on hierarchical path queries.
+	// The connections are stored per cluster in cluster_connections starting at cluster_connection_offsets[cluster].
+	// polygon_clusters is indexed with the same polygon ids as the path query slots.
+	LocalVector<Nav3D::PolygonCluster> clusters;
+	LocalVector<uint32_t> cluster_connection_offsets;
+	LocalVector<uint32_t> cluster_connections;
+	LocalVector<uint32_t> polygon_clusters;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
@@ -103,6 +111,10 @@ struct NavMapIteration3D {
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
 		region_ptr_to_region_iteration.clear();
+		clusters.clear();
+		cluster_connection_offsets.clear();
+		cluster_connections.clear();
+		polygon_clusters.clear();
 	}
 };
 
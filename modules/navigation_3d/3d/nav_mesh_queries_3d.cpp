@@ -293,9 +293,24 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	Vector3 new_entry = Geometry3D::get_closest_point_to_segment(p_least_cost_poly.entry, p_connection.pathway_start, p_connection.pathway_end);
 	real_t new_traveled_distance = p_least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + p_poly_enter_cost + p_least_cost_poly.traveled_distance;
 
+	const uint32_t neighbor_poly_id = p_query_task.path_query_slot->poly_to_id[p_connection.polygon];
+
+	// On a hierarchical query only the polygons of the cluster corridor are searched.
+	const LocalVector<uint32_t> *corridor_polygon_clusters = p_query_task.path_query_slot->corridor_polygon_clusters;
+	if (corridor_polygon_clusters) {
+		const NavigationCluster &neighbor_cluster = p_query_task.path_query_slot->cluster_corridor[(*corridor_polygon_clusters)[neighbor_poly_id]];
+		if (neighbor_cluster.corridor_search_id != p_query_task.path_query_slot->cluster_search_id) {
+			return;
+		}
+	}
+
 	// Check if the neighbor polygon has already been processed.
-	NavigationPoly &neighbor_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[p_connection.polygon]];
+	NavigationPoly &neighbor_poly = navigation_polys[neighbor_poly_id];
 	if (new_traveled_distance < neighbor_poly.traveled_distance) {
+		if (neighbor_poly.traveled_distance == FLT_MAX) {
+			p_query_task.path_query_slot->path_corridor_touched_ids.push_back(neighbor_poly_id);
+		}
+
 		// Add the polygon to the heap of polygons to traverse next.
 		neighbor_poly.back_navigation_poly_id = p_least_cost_id;
 		neighbor_poly.back_navigation_edge = p_connection.edge;
@@ -316,7 +331,120 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	}
 }
 
+bool NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	const LocalVector<PolygonCluster> &clusters = p_map_iteration.clusters;
+	if (clusters.is_empty()) {
+		return false;
+	}
+
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = p_query_task.path_query_slot;
+	const LocalVector<uint32_t> &polygon_clusters = p_map_iteration.polygon_clusters;
+	const uint32_t begin_cluster_id = polygon_clusters[path_query_slot->poly_to_id[p_query_task.begin_polygon]];
+	const uint32_t end_cluster_id = polygon_clusters[path_query_slot->poly_to_id[p_query_task.end_polygon]];
+	if (begin_cluster_id == end_cluster_id) {
+		// Nothing to gain, the regular search stays inside the cluster anyway.
+		return false;
+	}
+
+	LocalVector<NavigationCluster> &navigation_clusters = path_query_slot->cluster_corridor;
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer> &traversable_clusters = path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	// Search ids mark the clusters touched by this search so the scratch never needs a full reset.
+	path_query_slot->cluster_search_id++;
+	if (path_query_slot->cluster_search_id == 0) {
+		for (NavigationCluster &navigation_cluster : navigation_clusters) {
+			navigation_cluster.search_id = 0;
+			navigation_cluster.corridor_search_id = 0;
+		}
+		path_query_slot->cluster_search_id = 1;
+	}
+	const uint32_t search_id = path_query_slot->cluster_search_id;
+
+	const Vector3 &end_position = clusters[end_cluster_id].position;
+
+	NavigationCluster &begin_cluster = navigation_clusters[begin_cluster_id];
+	begin_cluster.search_id = search_id;
+	begin_cluster.back_cluster_id = UINT32_MAX;
+	begin_cluster.traveled_distance = 0.0;
+	begin_cluster.distance_to_destination = clusters[begin_cluster_id].position.distance_to(end_position) * clusters[begin_cluster_id].owner->get_travel_cost();
+	begin_cluster.traversable_cluster_index = Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>::INVALID_INDEX;
+	traversable_clusters.push(&begin_cluster);
+
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		NavigationCluster *least_cost_cluster = traversable_clusters.pop();
+		const uint32_t least_cost_id = least_cost_cluster - navigation_clusters.ptr();
+		if (least_cost_id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+
+		const PolygonCluster &cluster = clusters[least_cost_id];
+		for (uint32_t i = p_map_iteration.cluster_connection_offsets[least_cost_id]; i < p_map_iteration.cluster_connection_offsets[least_cost_id + 1]; i++) {
+			const uint32_t neighbor_id = p_map_iteration.cluster_connections[i];
+			const PolygonCluster &neighbor = clusters[neighbor_id];
+			if (!_query_task_is_connection_owner_usable(p_query_task, neighbor.owner)) {
+				continue;
+			}
+
+			real_t new_traveled_distance = least_cost_cluster->traveled_distance + cluster.position.distance_to(neighbor.position) * cluster.owner->get_travel_cost();
+			if (neighbor.owner != cluster.owner) {
+				new_traveled_distance += neighbor.owner->get_enter_cost();
+			}
+
+			NavigationCluster &neighbor_cluster = navigation_clusters[neighbor_id];
+			if (neighbor_cluster.search_id != search_id) {
+				neighbor_cluster.search_id = search_id;
+				neighbor_cluster.traversable_cluster_index = Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>::INVALID_INDEX;
+				neighbor_cluster.traveled_distance = FLT_MAX;
+				neighbor_cluster.distance_to_destination = neighbor.position.distance_to(end_position) * neighbor.owner->get_travel_cost();
+			}
+
+			if (new_traveled_distance < neighbor_cluster.traveled_distance) {
+				neighbor_cluster.back_cluster_id = least_cost_id;
+				neighbor_cluster.traveled_distance = new_traveled_distance;
+				if (neighbor_cluster.traversable_cluster_index != Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>::INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_cluster);
+				}
+			}
+		}
+	}
+	traversable_clusters.clear();
+
+	if (!found_route) {
+		// Let the regular search find the closest reachable polygon.
+		return false;
+	}
+
+	uint32_t corridor_cluster_id = end_cluster_id;
+	while (corridor_cluster_id != UINT32_MAX) {
+		navigation_clusters[corridor_cluster_id].corridor_search_id = search_id;
+		corridor_cluster_id = navigation_clusters[corridor_cluster_id].back_cluster_id;
+	}
+
+	path_query_slot->corridor_polygon_clusters = &polygon_clusters;
+	return true;
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	// Hierarchical query, search the cluster graph first and then only the polygons of the clusters along that route.
+	// The corridor can miss a route that exists through other clusters, so fall back to the full search when it fails.
+	// Reaching the search limits inside the corridor is final though, a full search wouldn't get further.
+	if (_query_task_build_cluster_corridor(p_query_task, p_map_iteration)) {
+		const bool finished = _query_task_search_path_corridor(p_query_task, p_map_iteration, true);
+		p_query_task.path_query_slot->corridor_polygon_clusters = nullptr;
+		if (finished) {
+			return;
+		}
+	}
+
+	_query_task_search_path_corridor(p_query_task, p_map_iteration, false);
+}
+
+bool NavMeshQueries3D::_query_task_search_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, bool p_restricted) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
 	const Polygon *end_poly = p_query_task.end_polygon;
@@ -329,11 +457,14 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	traversable_polys.clear();
 
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
-	for (NavigationPoly &polygon : navigation_polys) {
-		polygon.reset();
+	LocalVector<uint32_t> &touched_ids = p_query_task.path_query_slot->path_corridor_touched_ids;
+	for (uint32_t touched_id : touched_ids) {
+		navigation_polys[touched_id].reset();
 	}
+	touched_ids.clear();
 
 	// Initialize the matching navigation polygon.
+	touched_ids.push_back(p_query_task.path_query_slot->poly_to_id[begin_poly]);
 	NavigationPoly &begin_navigation_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[begin_poly]];
 	begin_navigation_poly.poly = begin_poly;
 	begin_navigation_poly.entry = begin_point;
@@ -400,6 +531,11 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_restricted && !path_search_max_reached) {
+				// The end polygon is not reachable inside the cluster corridor.
+				return false;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -443,12 +579,12 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 				_query_task_push_back_point_with_metadata(p_query_task, begin_point, begin_poly);
 				_query_task_push_back_point_with_metadata(p_query_task, end_point, begin_poly);
 				p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED;
-				return;
+				return true;
 			}
 
-			for (NavigationPoly &nav_poly : navigation_polys) {
-				nav_poly.poly = nullptr;
-				nav_poly.traveled_distance = FLT_MAX;
+			for (uint32_t touched_id : touched_ids) {
+				navigation_polys[touched_id].poly = nullptr;
+				navigation_polys[touched_id].traveled_distance = FLT_MAX;
 			}
 			uint32_t _bp_id = p_query_task.path_query_slot->poly_to_id[begin_poly];
 			navigation_polys[_bp_id].poly = begin_poly;
@@ -475,7 +611,7 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 			}
 
 			if (navigation_polys[least_cost_id].poly->owner->get_self() != least_cost_poly.poly->owner->get_self()) {
-				ERR_FAIL_NULL(least_cost_poly.poly->owner);
+				ERR_FAIL_NULL_V(least_cost_poly.poly->owner, false);
 				poly_enter_cost = least_cost_poly.poly->owner->get_enter_cost();
 			}
 		}
@@ -509,6 +645,8 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		p_query_task.begin_polygon = begin_poly;
 		p_query_task.least_cost_id = least_cost_id;
 	}
+
+	return found_route || path_search_max_reached;
 }
 
 void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
@@ -35,6 +35,7 @@
 #include "nav_region_iteration_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/templates/hash_set.h"
 
 using namespace Nav3D;
 
@@ -53,6 +54,8 @@ void NavRegionBuilder3D::build_iteration(NavRegionIterationBuild3D &r_build) {
 
 	_build_step_merge_edge_connection_pairs(r_build);
 
+	_build_step_polygon_clusters(r_build);
+
 	_build_update_iteration(r_build);
 }
 
@@ -258,6 +261,104 @@ void NavRegionBuilder3D::_build_step_merge_edge_connection_pairs(NavRegionIterat
 	}
 }
 
+void NavRegionBuilder3D::_build_step_polygon_clusters(NavRegionIterationBuild3D &r_build) {
+	Ref<NavRegionIteration3D> region_iteration = r_build.region_iteration;
+	const LocalVector<Nav3D::Polygon> &navmesh_polygons = region_iteration->navmesh_polygons;
+
+	LocalVector<uint32_t> &polygon_clusters = region_iteration->polygon_clusters;
+	LocalVector<Vector3> &cluster_positions = region_iteration->cluster_positions;
+	LocalVector<ClusterEdge> &cluster_edges = region_iteration->cluster_edges;
+
+	polygon_clusters.clear();
+	cluster_positions.clear();
+	cluster_edges.clear();
+
+	const real_t cluster_size = r_build.cluster_size;
+	if (cluster_size <= 0.0) {
+		return;
+	}
+
+	const uint32_t polygon_count = navmesh_polygons.size();
+
+	// Bucket the polygons by the cluster cell that contains their center.
+	LocalVector<uint64_t> polygon_cells;
+	polygon_cells.resize(polygon_count);
+	LocalVector<Vector3> polygon_centers;
+	polygon_centers.resize(polygon_count);
+	const Vector3 cluster_cell_size(cluster_size, cluster_size, cluster_size);
+
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const Polygon &polygon = navmesh_polygons[i];
+		Vector3 center;
+		for (const Vector3 &vertex : polygon.vertices) {
+			center += vertex;
+		}
+		if (!polygon.vertices.is_empty()) {
+			center /= polygon.vertices.size();
+		}
+		polygon_centers[i] = center;
+		polygon_cells[i] = get_point_key(center, cluster_cell_size).key;
+	}
+
+	// A cluster is a connected set of polygons inside the same cell, so stacked floors
+	// or polygons separated by walls inside one cell never share a cluster.
+	polygon_clusters.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		polygon_clusters[i] = UINT32_MAX;
+	}
+
+	LocalVector<uint32_t> stack;
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		if (polygon_clusters[i] != UINT32_MAX) {
+			continue;
+		}
+
+		const uint32_t cluster_index = cluster_positions.size();
+		Vector3 cluster_position;
+		uint32_t cluster_polygon_count = 0;
+
+		polygon_clusters[i] = cluster_index;
+		stack.push_back(i);
+		while (!stack.is_empty()) {
+			const uint32_t polygon_index = stack[stack.size() - 1];
+			stack.remove_at(stack.size() - 1);
+
+			cluster_position += polygon_centers[polygon_index];
+			cluster_polygon_count++;
+
+			for (const Connection &connection : region_iteration->internal_connections[polygon_index]) {
+				const uint32_t neighbor_index = connection.polygon->id;
+				if (polygon_clusters[neighbor_index] == UINT32_MAX && polygon_cells[neighbor_index] == polygon_cells[i]) {
+					polygon_clusters[neighbor_index] = cluster_index;
+					stack.push_back(neighbor_index);
+				}
+			}
+		}
+
+		cluster_positions.push_back(cluster_position / cluster_polygon_count);
+	}
+
+	// Connect the clusters that share at least one polygon edge.
+	HashSet<uint64_t> cluster_edge_keys;
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const uint32_t from = polygon_clusters[i];
+		for (const Connection &connection : region_iteration->internal_connections[i]) {
+			const uint32_t to = polygon_clusters[connection.polygon->id];
+			if (from == to) {
+				continue;
+			}
+			const uint64_t edge_key = (uint64_t(from) << 32) | to;
+			if (!cluster_edge_keys.has(edge_key)) {
+				cluster_edge_keys.insert(edge_key);
+				ClusterEdge edge;
+				edge.from = from;
+				edge.to = to;
+				cluster_edges.push_back(edge);
+			}
+		}
+	}
+}
+
 void NavRegionBuilder3D::_build_update_iteration(NavRegionIterationBuild3D &r_build) {
 	ERR_FAIL_NULL(r_build.region);
 	// Stub. End of the build.
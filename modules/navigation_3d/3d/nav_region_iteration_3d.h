@@ -46,6 +46,7 @@ struct NavRegionIterationBuild3D {
 
 	Vector3 map_cell_size;
 	Transform3D region_transform;
+	real_t cluster_size = 0.0;
 
 	struct NavMeshData {
 		Vector<Vector3> vertices;
@@ -79,13 +80,22 @@ public:
 	AABB bounds;
 	LocalVector<Nav3D::ConnectableEdge> external_edges;
 
+	// Connected groups of nearby polygons used by the map for hierarchical path queries, empty when disabled.
+	LocalVector<uint32_t> polygon_clusters;
+	LocalVector<Vector3> cluster_positions;
+	LocalVector<Nav3D::ClusterEdge> cluster_edges;
+
 	const Transform3D &get_transform() const { return transform; }
 	real_t get_surface_area() const { return surface_area; }
 	AABB get_bounds() const { return bounds; }
 	const LocalVector<Nav3D::ConnectableEdge> &get_external_edges() const { return external_edges; }
+	bool has_clusters() const { return polygon_clusters.size() == navmesh_polygons.size(); }
 
 	virtual ~NavRegionIteration3D() override {
 		external_edges.clear();
+		polygon_clusters.clear();
+		cluster_positions.clear();
+		cluster_edges.clear();
 		navmesh_polygons.clear();
 		internal_connections.clear();
 	}
@@ -143,6 +143,36 @@ PointKey NavMap3D::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
+static NavMeshQueries3D::PathQuerySlot *_acquire_path_query_slot(NavMapIteration3D &p_map_iteration) {
+	p_map_iteration.path_query_slots_semaphore.wait();
+
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
+	p_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : p_map_iteration.path_query_slots) {
+		if (!p_path_query_slot.in_use) {
+			p_path_query_slot.in_use = true;
+			path_query_slot = &p_path_query_slot;
+			break;
+		}
+	}
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		p_map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_NULL_V_MSG(path_query_slot, nullptr, "No unused NavMap3D path query slot found! This should never happen :(.");
+	}
+
+	return path_query_slot;
+}
+
+static void _release_path_query_slot(NavMapIteration3D &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	p_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	p_map_iteration.path_query_slots_semaphore.post();
+}
+
 void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
 	if (iteration_id == 0) {
 		return;
@@ -150,34 +180,121 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 
 	GET_MAP_ITERATION();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	p_query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
+	if (p_query_task.path_query_slot == nullptr) {
+		return;
+	}
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
-		if (!p_path_query_slot.in_use) {
-			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+	p_query_task.map_up = map_iteration.map_up;
+
+	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+
+	_release_path_query_slot(map_iteration, p_query_task.path_query_slot);
+	p_query_task.path_query_slot = nullptr;
+}
+
+void NavMap3D::_query_path_batch_threaded(uint32_t p_worker, PathQueryBatch *p_batch) {
+	NavMapIteration3D &map_iteration = *p_batch->map_iteration;
+
+	// Each worker keeps one slot and one task for all the queries it claims, so the search state is reused.
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task = *p_batch->query_template;
+	query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
+	if (query_task.path_query_slot == nullptr) {
+		return;
+	}
+	query_task.map_up = map_iteration.map_up;
+
+	LocalVector<Vector3> &path_points = p_batch->worker_path_points[p_worker];
+
+	while (true) {
+		uint32_t query_index = p_batch->next_query.postincrement();
+		if (query_index >= p_batch->query_count) {
 			break;
 		}
+
+		query_task.start_position = p_batch->start_positions[query_index];
+		query_task.target_position = p_batch->target_positions[query_index];
+		query_task.begin_polygon = nullptr;
+		query_task.end_polygon = nullptr;
+		query_task.least_cost_id = 0;
+		query_task.path_length = 0.0;
+		query_task.status = NavMeshQueries3D::NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+
+		NavMeshQueries3D::query_task_map_iteration_get_path(query_task, map_iteration);
+
+		p_batch->query_worker[query_index] = p_worker;
+		p_batch->query_point_offset[query_index] = path_points.size();
+		p_batch->query_point_count[query_index] = query_task.path_points.size();
+		for (const Vector3 &point : query_task.path_points) {
+			path_points.push_back(point);
+		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
 
-	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+	_release_path_query_slot(map_iteration, query_task.path_query_slot);
+}
+
+void NavMap3D::query_path_batch(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_template, const Vector3 *p_start_positions, const Vector3 *p_target_positions, uint32_t p_query_count, LocalVector<Vector3> &r_path_points, LocalVector<int32_t> &r_path_ends) {
+	r_path_points.clear();
+	r_path_ends.resize(p_query_count);
+	if (p_query_count == 0) {
+		return;
 	}
 
-	p_query_task.map_up = map_iteration.map_up;
+	if (iteration_id == 0) {
+		for (uint32_t i = 0; i < p_query_count; i++) {
+			r_path_ends[i] = 0;
+		}
+		return;
+	}
 
-	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
+	GET_MAP_ITERATION();
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
-	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+	PathQueryBatch batch;
+	batch.map_iteration = &map_iteration;
+	batch.query_template = &p_query_template;
+	batch.start_positions = p_start_positions;
+	batch.target_positions = p_target_positions;
+	batch.query_count = p_query_count;
+	batch.query_worker.resize(p_query_count);
+	batch.query_point_offset.resize(p_query_count);
+	batch.query_point_count.resize(p_query_count);
+	for (uint32_t i = 0; i < p_query_count; i++) {
+		batch.query_worker[i] = 0;
+		batch.query_point_offset[i] = 0;
+		batch.query_point_count[i] = 0;
+	}
+
+	// Never use more workers than there are path query slots, so the workers never wait for each other.
+	uint32_t worker_count = MIN(p_query_count, map_iteration.path_query_slots.size());
+	if (use_threads) {
+		worker_count = MIN(worker_count, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count());
+	} else {
+		worker_count = MIN(worker_count, 1u);
+	}
+	ERR_FAIL_COND(worker_count == 0);
+	batch.worker_path_points.resize(worker_count);
 
-	map_iteration.path_query_slots_semaphore.post();
+	if (worker_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_query_path_batch_threaded, &batch, worker_count, -1, true, SNAME("NavMapQueryPathBatch"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_query_path_batch_threaded(0, &batch);
+	}
+
+	uint32_t total_points = 0;
+	for (uint32_t i = 0; i < p_query_count; i++) {
+		total_points += batch.query_point_count[i];
+	}
+	r_path_points.resize(total_points);
+
+	uint32_t write_index = 0;
+	for (uint32_t i = 0; i < p_query_count; i++) {
+		const Vector3 *src = batch.worker_path_points[batch.query_worker[i]].ptr() + batch.query_point_offset[i];
+		for (uint32_t j = 0; j < batch.query_point_count[i]; j++) {
+			r_path_points[write_index++] = src[j];
+		}
+		r_path_ends[i] = write_index;
+	}
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -154,6 +154,20 @@ class NavMap3D : public NavRid3D {
 	void _build_iteration();
 	void _sync_iteration();
 
+	struct PathQueryBatch {
+		NavMapIteration3D *map_iteration = nullptr;
+		const NavMeshQueries3D::NavMeshPathQueryTask3D *query_template = nullptr;
+		const Vector3 *start_positions = nullptr;
+		const Vector3 *target_positions = nullptr;
+		uint32_t query_count = 0;
+		SafeNumeric<uint32_t> next_query;
+		LocalVector<LocalVector<Vector3>> worker_path_points;
+		LocalVector<uint32_t> query_worker;
+		LocalVector<uint32_t> query_point_offset;
+		LocalVector<uint32_t> query_point_count;
+	};
+	void _query_path_batch_threaded(uint32_t p_worker, PathQueryBatch *p_batch);
+
 public:
 	NavMap3D();
 	~NavMap3D();
@@ -197,6 +211,9 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	// Solves many queries sharing the settings of p_query_template against the same map iteration.
+	// The points of all paths are concatenated in r_path_points, r_path_ends holds the end index of each path.
+	void query_path_batch(const NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_template, const Vector3 *p_start_positions, const Vector3 *p_target_positions, uint32_t p_query_count, LocalVector<Vector3> &r_path_points, LocalVector<int32_t> &r_path_ends);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
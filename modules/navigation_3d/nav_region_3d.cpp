@@ -255,6 +255,7 @@ void NavRegion3D::_build_iteration() {
 	}
 
 	iteration_build.map_cell_size = map->get_merge_rasterizer_cell_size();
+	iteration_build.cluster_size = GLOBAL_GET_CACHED(real_t, "navigation/pathfinding/hierarchical_cluster_size");
 
 	Ref<NavRegionIteration3D> new_iteration;
 	new_iteration.instantiate();
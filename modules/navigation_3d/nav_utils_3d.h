@@ -171,6 +171,50 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct PolygonCluster {
+	/// Navigation region or link that contains the polygons of this cluster.
+	const NavBaseIteration3D *owner = nullptr;
+
+	/// Average center of the cluster polygons.
+	Vector3 position;
+};
+
+struct ClusterEdge {
+	uint32_t from = 0;
+	uint32_t to = 0;
+};
+
+struct NavigationCluster {
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	/// Search that last touched this cluster, all other values are stale when it doesn't match.
+	uint32_t search_id = 0;
+
+	/// Search whose cluster corridor includes this cluster.
+	uint32_t corridor_search_id = 0;
+
+	uint32_t back_cluster_id = UINT32_MAX;
+	real_t traveled_distance = 0.0;
+	real_t distance_to_destination = 0.0;
+
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		return p_cluster_a->total_travel_cost() > p_cluster_b->total_travel_cost();
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -46,6 +46,7 @@ void initialize_raycast_module(ModuleInitializationLevel p_level) {
 	StaticRaycasterEmbree::make_default_raycaster();
 #endif
 	raycast_occlusion_cull = memnew(RaycastOcclusionCull);
+	raycast_occlusion_cull->replace_singleton();
 }
 
 void uninitialize_raycast_module(ModuleInitializationLevel p_level) {
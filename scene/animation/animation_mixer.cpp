@@ -33,6 +33,8 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
@@ -581,6 +583,11 @@ bool AnimationMixer::is_dummy() const {
 /* -------------------------------------------- */
 
 void AnimationMixer::_clear_caches() {
+	if (blend_batch_state != BLEND_BATCH_NONE) {
+		// The pending blend refers to the caches being deleted, drop it.
+		blend_batch_state = BLEND_BATCH_NONE;
+		clear_animation_instances();
+	}
 	_init_root_motion_cache();
 	_clear_audio_streams();
 	_clear_playing_caches();
@@ -990,6 +997,21 @@ bool AnimationMixer::_update_caches() {
 
 	track_count = idx;
 
+	// Method, audio, animation and value tracks touch other objects while blending, so they must stay on the main thread.
+	blend_process_thread_safe = true;
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		switch (K.value->type) {
+			case Animation::TYPE_POSITION_3D:
+			case Animation::TYPE_ROTATION_3D:
+			case Animation::TYPE_SCALE_3D:
+			case Animation::TYPE_BLEND_SHAPE: {
+			} break;
+			default: {
+				blend_process_thread_safe = false;
+			} break;
+		}
+	}
+
 	cache_valid = true;
 
 	return true;
@@ -1000,6 +1022,7 @@ bool AnimationMixer::_update_caches() {
 /* -------------------------------------------- */
 
 void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
+	_finish_pending_blend();
 	_blend_init();
 	if (cache_valid && _blend_pre_process(p_delta, track_count, track_map)) {
 		_blend_capture(p_delta);
@@ -1012,6 +1035,95 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+LocalVector<ObjectID> AnimationMixer::blend_batch;
+
+bool AnimationMixer::_can_batch_blend() {
+	// The batch is only flushed from the main thread, mixers in a sub-thread process group are processed immediately.
+	return Thread::is_main_thread() && !Engine::get_singleton()->is_editor_hint() && GLOBAL_GET_CACHED(bool, "animation/mixers/parallel_blending");
+}
+
+void AnimationMixer::_process_animation_batched(double p_delta) {
+	// Same as _process_animation(), but _blend_process() is postponed until the message queue is flushed,
+	// so the blends of all mixers processed in this frame can run in parallel.
+	_finish_pending_blend();
+	_blend_init();
+	if (!cache_valid || !_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_capture(p_delta);
+	_blend_calc_total_weight();
+	if (!blend_process_thread_safe || GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value)) {
+		_blend_process(p_delta);
+		_blend_finish();
+		return;
+	}
+
+	is_GDVIRTUAL_CALL_post_process_key_value = false; // Not overridden, avoid the lookup from the worker threads.
+	blend_batch_state = BLEND_BATCH_QUEUED;
+	blend_batch_delta = p_delta;
+	if (blend_batch.is_empty()) {
+		callable_mp_static(&AnimationMixer::_process_blend_batch).call_deferred();
+	}
+	blend_batch.push_back(get_instance_id());
+}
+
+void AnimationMixer::_blend_finish() {
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+	clear_animation_instances();
+}
+
+void AnimationMixer::_finish_pending_blend() {
+	if (blend_batch_state == BLEND_BATCH_NONE) {
+		return;
+	}
+	// Processed again before the batch was flushed (e.g. seeked from a script), complete the pending blend first.
+	if (blend_batch_state == BLEND_BATCH_QUEUED) {
+		_blend_process(blend_batch_delta);
+	}
+	blend_batch_state = BLEND_BATCH_NONE;
+	_blend_finish();
+}
+
+void AnimationMixer::_blend_batch_task(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	mixer->_blend_process(mixer->blend_batch_delta);
+	mixer->blend_batch_state = BLEND_BATCH_BLENDED;
+}
+
+void AnimationMixer::_process_blend_batch() {
+	LocalVector<ObjectID> ids = std::move(blend_batch);
+	blend_batch.clear();
+
+	LocalVector<AnimationMixer *> mixers;
+	mixers.reserve(ids.size());
+	for (const ObjectID &id : ids) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->blend_batch_state == BLEND_BATCH_QUEUED) {
+			mixers.push_back(mixer);
+		}
+	}
+
+	if (mixers.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_blend_batch_task, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (mixers.size() == 1) {
+		_blend_batch_task(mixers.ptr(), 0);
+	}
+
+	// Applying touches the scene, keep it on the main thread and in processing order.
+	// Signal callbacks may free or reprocess mixers, so look them up again.
+	for (const ObjectID &id : ids) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->blend_batch_state == BLEND_BATCH_BLENDED) {
+			mixer->blend_batch_state = BLEND_BATCH_NONE;
+			mixer->_blend_finish();
+		}
+	}
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1209,6 +1321,13 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		real_t a_length = a->get_length();
 		int count = tracks.size();
+#ifndef _3D_DISABLED
+		// Decode all compressed tracks at once instead of seeking the pages of each track separately.
+		bool use_compressed_samples = a->is_compressed();
+		if (use_compressed_samples) {
+			a->sample_compressed_tracks(time, compressed_samples, compressed_samples_valid);
+		}
+#endif // _3D_DISABLED
 		for (int i = 0; i < count; i++) {
 			const Animation::Track *animation_track = tracks_ptr[i];
 			if (!animation_track->enabled) {
@@ -1366,9 +1485,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
-						if (err != OK) {
-							continue;
+						if (use_compressed_samples && compressed_samples_valid[i]) {
+							const Vector4 &sample = compressed_samples[i];
+							loc = Vector3(sample.x, sample.y, sample.z);
+						} else {
+							Error err = a->try_position_track_interpolate(i, time, &loc);
+							if (err != OK) {
+								continue;
+							}
 						}
 						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
 						t->loc += (loc - t->init_loc) * blend;
@@ -1454,9 +1578,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
-						if (err != OK) {
-							continue;
+						if (use_compressed_samples && compressed_samples_valid[i]) {
+							const Vector4 &sample = compressed_samples[i];
+							rot = Quaternion(sample.x, sample.y, sample.z, sample.w);
+						} else {
+							Error err = a->try_rotation_track_interpolate(i, time, &rot);
+							if (err != OK) {
+								continue;
+							}
 						}
 						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
 						t->rot = Animation::interpolate_via_rest(t->rot, rot, blend, t->init_rot);
@@ -1542,9 +1671,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
-						if (err != OK) {
-							continue;
+						if (use_compressed_samples && compressed_samples_valid[i]) {
+							const Vector4 &sample = compressed_samples[i];
+							scale = Vector3(sample.x, sample.y, sample.z);
+						} else {
+							Error err = a->try_scale_track_interpolate(i, time, &scale);
+							if (err != OK) {
+								continue;
+							}
 						}
 						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
 						t->scale += (scale - t->init_scale) * blend;
@@ -1558,10 +1692,14 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 					float value;
-					Error err = a->try_blend_shape_track_interpolate(i, time, &value);
-					//ERR_CONTINUE(err!=OK); //used for testing, should be removed
-					if (err != OK) {
-						continue;
+					if (use_compressed_samples && compressed_samples_valid[i]) {
+						value = compressed_samples[i].x;
+					} else {
+						Error err = a->try_blend_shape_track_interpolate(i, time, &value);
+						//ERR_CONTINUE(err!=OK); //used for testing, should be removed
+						if (err != OK) {
+							continue;
+						}
 					}
 					value = post_process_key_value(a, i, value, t->object_id, t->shape_index);
 					t->value += (value - t->init_value) * blend;
@@ -2355,13 +2493,21 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				if (_can_batch_blend()) {
+					_process_animation_batched(get_process_delta_time());
+				} else {
+					_process_animation(get_process_delta_time());
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				if (_can_batch_blend()) {
+					_process_animation_batched(get_physics_process_delta_time());
+				} else {
+					_process_animation(get_physics_process_delta_time());
+				}
 			}
 		} break;
 
@@ -306,6 +306,8 @@ protected:
 	RootMotionCache root_motion_cache;
 	AHashMap<Animation::TypeHash, TrackCache *, HashHasher> track_cache;
 	AHashMap<Ref<Animation>, LocalVector<TrackCache *>> animation_track_num_to_track_cache;
+	LocalVector<Vector4> compressed_samples; // Scratch for Animation::sample_compressed_tracks().
+	LocalVector<uint8_t> compressed_samples_valid;
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
 
@@ -372,6 +374,24 @@ protected:
 	virtual void _blend_post_process();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
+	/* ---- Batched blending ---- */
+	// Mixers whose tracks only write into their own caches can run _blend_process() on the WorkerThreadPool.
+	enum BlendBatchState {
+		BLEND_BATCH_NONE,
+		BLEND_BATCH_QUEUED,
+		BLEND_BATCH_BLENDED,
+	};
+	bool blend_process_thread_safe = false;
+	BlendBatchState blend_batch_state = BLEND_BATCH_NONE;
+	double blend_batch_delta = 0.0;
+	static LocalVector<ObjectID> blend_batch;
+	static bool _can_batch_blend();
+	void _process_animation_batched(double p_delta);
+	void _blend_finish();
+	void _finish_pending_blend();
+	static void _blend_batch_task(void *p_userdata, uint32_t p_index);
+	static void _process_blend_batch();
+
 	/* ---- Capture feature ---- */
 	struct CaptureCache {
 		Ref<Animation> animation;
@@ -54,6 +54,9 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, Engine);
 #ifdef DEBUG_ENABLED
 SafeNumeric<uint64_t> Node::total_node_count{ 0 };
 #endif
+SafeNumeric<uint64_t> Node::structure_generation{ 1 };
+uint64_t Node::path_cache_hits = 0;
+uint64_t Node::path_cache_misses = 0;
 
 thread_local Node *Node::current_process_thread_group = nullptr;
 
@@ -124,6 +127,11 @@ void Node::_notification(int p_notification) {
 			}
 
 			{ // Update threaded process mode.
+				if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT && !data.process_thread_group_explicit && data.tree->_is_auto_process_thread_group(this)) {
+					data.process_thread_group = PROCESS_THREAD_GROUP_SUB_THREAD;
+					data.process_thread_group_auto = true;
+				}
+
 				if (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
 					if (data.parent) {
 						data.process_thread_group_owner = data.parent->data.process_thread_group_owner;
@@ -224,6 +232,10 @@ void Node::_notification(int p_notification) {
 				_remove_process_group();
 			}
 			data.process_thread_group_owner = nullptr;
+			if (data.process_thread_group_auto) {
+				data.process_thread_group = PROCESS_THREAD_GROUP_INHERIT;
+				data.process_thread_group_auto = false;
+			}
 			data.process_owner = nullptr;
 
 			if (data.path_cache) {
@@ -1193,6 +1205,9 @@ int Node::get_physics_process_priority() const {
 
 void Node::set_process_thread_group(ProcessThreadGroup p_mode) {
 	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Changing the process thread group can only be done from the main thread. Use call_deferred(\"set_process_thread_group\",mode).");
+	// An explicit mode always wins, including an explicit Inherit.
+	data.process_thread_group_auto = false;
+	data.process_thread_group_explicit = true;
 	if (data.process_thread_group == p_mode) {
 		return;
 	}
@@ -1425,6 +1440,7 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 	data.name = p_name;
+	structure_generation.increment();
 }
 
 void Node::set_name(const StringName &p_name) {
@@ -1451,6 +1467,7 @@ void Node::set_name(const StringName &p_name) {
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
 		ERR_FAIL_COND_MSG(!success, "Renaming child in hashtable failed, this is a bug.");
 	}
+	structure_generation.increment();
 
 	if (data.unique_name_in_owner && data.owner) {
 		_acquire_unique_name_in_owner();
@@ -1654,6 +1671,7 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	structure_generation.increment();
 
 	p_child->data.internal_mode = p_internal_mode;
 
@@ -1759,6 +1777,7 @@ void Node::remove_child(RequiredParam<Node> rp_child) {
 	data.children_cache_dirty = true;
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+	structure_generation.increment();
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
@@ -1897,6 +1916,70 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Single names are a hash lookup already; longer paths go through the cache.
+	// It isn't synchronized, so group processing threads resolve paths directly.
+	if ((p_path.get_name_count() > 1 || p_path.is_absolute()) && Thread::is_main_thread()) {
+		return _get_node_cached(p_path);
+	}
+
+	return _get_node_uncached(p_path);
+}
+
+Node *Node::_get_node_cached(const NodePath &p_path) const {
+	if (!data.get_node_cache) {
+		data.get_node_cache = memnew(NodePathCache);
+	}
+
+	NodePathCache &cache = *data.get_node_cache;
+	const uint64_t generation = structure_generation.get();
+	if (cache.generation != generation) {
+		cache.generation = generation;
+		cache.used = 0;
+		cache.next = 0;
+	}
+
+	uint32_t slot = NodePathCache::SIZE;
+	for (uint32_t i = 0; i < cache.used; i++) {
+		const NodePathCache::Entry &entry = cache.entries[i];
+		if (entry.path != p_path) {
+			continue;
+		}
+
+		if (entry.target.is_null()) {
+			path_cache_hits++;
+			return nullptr;
+		}
+
+		Object *target = ObjectDB::get_instance(entry.target);
+		if (target) {
+			path_cache_hits++;
+			return static_cast<Node *>(target);
+		}
+
+		// The target was freed since, resolve the path again.
+		slot = i;
+		break;
+	}
+
+	path_cache_misses++;
+	Node *node = _get_node_uncached(p_path);
+
+	if (slot == NodePathCache::SIZE) {
+		if (cache.used < NodePathCache::SIZE) {
+			slot = cache.used++;
+		} else {
+			slot = cache.next;
+			cache.next = (cache.next + 1) % NodePathCache::SIZE;
+		}
+	}
+
+	cache.entries[slot].path = p_path;
+	cache.entries[slot].target = node ? node->get_instance_id() : ObjectID();
+
+	return node;
+}
+
+Node *Node::_get_node_uncached(const NodePath &p_path) const {
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -2217,6 +2300,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	structure_generation.increment();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2231,6 +2315,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	structure_generation.increment();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -3610,9 +3695,12 @@ void Node::_call_unhandled_key_input(const Ref<InputEvent> &p_event) {
 }
 
 void Node::_validate_property(PropertyInfo &p_property) const {
-	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT) {
+	if ((p_property.name == "process_thread_group_order" || p_property.name == "process_thread_messages") && (data.process_thread_group == PROCESS_THREAD_GROUP_INHERIT || data.process_thread_group_auto)) {
 		p_property.usage = 0;
 	}
+	if (p_property.name == "process_thread_group" && data.process_thread_group_auto) {
+		p_property.usage &= ~PROPERTY_USAGE_STORAGE;
+	}
 }
 
 String Node::_to_string() {
@@ -4114,6 +4202,9 @@ Node::Node() {
 
 	data.use_placeholder = false;
 
+	data.process_thread_group_auto = false;
+	data.process_thread_group_explicit = false;
+
 	data.display_folded = false;
 	data.editable_instance = false;
 
@@ -4129,6 +4220,9 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.get_node_cache) {
+		memdelete(data.get_node_cache);
+	}
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
@@ -136,6 +136,9 @@ public:
 #ifdef DEBUG_ENABLED
 	static SafeNumeric<uint64_t> total_node_count;
 #endif
+	// Lookups answered by the get_node() path cache, and the ones that had to resolve the path. Main thread only.
+	static uint64_t path_cache_hits;
+	static uint64_t path_cache_misses;
 	enum {
 		UNIQUE_SCENE_ID_UNASSIGNED = 0
 	};
@@ -191,6 +194,24 @@ private:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.physics_process_priority == p_a->data.physics_process_priority ? p_b->is_greater_than(p_a) : p_b->data.physics_process_priority > p_a->data.physics_process_priority; }
 	};
 
+	// Recently resolved paths of a node. Entries are only valid for the tree structure generation they were resolved in.
+	struct NodePathCache {
+		static constexpr uint32_t SIZE = 8;
+
+		struct Entry {
+			NodePath path;
+			ObjectID target; // Null if the path didn't resolve.
+		};
+
+		Entry entries[SIZE];
+		uint64_t generation = 0;
+		uint32_t used = 0;
+		uint32_t next = 0;
+	};
+
+	// Bumped whenever a change could make a path resolve to another node.
+	static SafeNumeric<uint64_t> structure_generation;
+
 	// This Data struct is to avoid namespace pollution in derived classes.
 	struct Data {
 		String scene_file_path;
@@ -204,6 +225,7 @@ private:
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
 		bool unique_name_in_owner = false;
+		mutable NodePathCache *get_node_cache = nullptr;
 		InternalMode internal_mode = INTERNAL_MODE_DISABLED;
 		mutable int internal_children_front_count_cache = 0;
 		mutable int internal_children_back_count_cache = 0;
@@ -276,6 +298,11 @@ private:
 
 		bool use_placeholder : 1;
 
+		// Set when the SceneTree made this node a sub-thread process group on its own.
+		bool process_thread_group_auto : 1;
+		// Set once the process thread group was chosen explicitly, which disables automatic grouping.
+		bool process_thread_group_explicit : 1;
+
 		bool display_folded : 1;
 		bool editable_instance : 1;
 
@@ -393,6 +420,9 @@ protected:
 	void _set_owner_nocheck(Node *p_owner);
 	void _set_name_nocheck(const StringName &p_name);
 
+	Node *_get_node_uncached(const NodePath &p_path) const;
+	Node *_get_node_cached(const NodePath &p_path) const;
+
 	void _set_physics_interpolated_client_side(bool p_enable) { data.physics_interpolated_client_side = p_enable; }
 	bool _is_physics_interpolated_client_side() const { return data.physics_interpolated_client_side; }
 
@@ -1346,6 +1346,16 @@ bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const P
 	}
 }
 
+bool SceneTree::_is_auto_process_thread_group(const Node *p_node) const {
+	if (!auto_process_thread_groups || p_node->data.scene_file_path.is_empty()) {
+		return false;
+	}
+	// Instantiated scenes directly under the main thread group, other than the
+	// current scene and autoloads, become sub-thread groups of their own.
+	const Node *parent = p_node->data.parent;
+	return parent && parent != root && parent->data.process_thread_group_owner == nullptr;
+}
+
 void SceneTree::_remove_process_group(Node *p_node) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = (ProcessGroup *)p_node->data.process_group;
@@ -2021,6 +2031,10 @@ void SceneTree::set_disable_node_threading(bool p_disable) {
 	node_threading_disabled = p_disable;
 }
 
+void SceneTree::set_auto_process_thread_groups(bool p_enable) {
+	auto_process_thread_groups = p_enable;
+}
+
 SceneTree::SceneTree() {
 	if (singleton == nullptr) {
 		singleton = this;
@@ -2063,6 +2077,8 @@ SceneTree::SceneTree() {
 
 	set_physics_interpolation_enabled(GLOBAL_DEF("physics/common/physics_interpolation", false));
 
+	auto_process_thread_groups = GLOBAL_DEF("application/run/auto_process_thread_groups", false) && !Engine::get_singleton()->is_editor_hint();
+
 	// Always disable jitter fix if physics interpolation is enabled -
 	// Jitter fix will interfere with interpolation, and is not necessary
 	// when interpolation is active.
@@ -116,6 +116,9 @@ private:
 	ProcessGroup default_process_group;
 
 	bool node_threading_disabled = false;
+	bool auto_process_thread_groups = false;
+
+	bool _is_auto_process_thread_group(const Node *p_node) const;
 
 	struct Group {
 		Vector<Node *> nodes;
@@ -452,6 +455,9 @@ public:
 	static void add_idle_callback(IdleCallback p_callback);
 
 	void set_disable_node_threading(bool p_disable);
+	// Only affects nodes entering the tree afterwards.
+	void set_auto_process_thread_groups(bool p_enable);
+	bool is_auto_process_thread_groups_enabled() const { return auto_process_thread_groups; }
 	//default texture settings
 
 	void set_physics_interpolation_enabled(bool p_enabled);
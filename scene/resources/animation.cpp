@@ -2247,6 +2247,71 @@ bool Animation::track_is_compressed(int p_track) const {
 	}
 }
 
+bool Animation::is_compressed() const {
+	return compression.enabled;
+}
+
+void Animation::sample_compressed_tracks(double p_time, LocalVector<Vector4> &r_values, LocalVector<uint8_t> &r_valid) const {
+	// Samples all compressed tracks at once, so the page lookup is shared between them.
+	// Rotations are stored as (x, y, z, w), positions and scales as (x, y, z, 0) and blend shapes as (value, 0, 0, 0).
+	uint32_t track_count = tracks.size();
+	r_values.resize(track_count);
+	r_valid.resize(track_count);
+	if (track_count == 0) {
+		return;
+	}
+	memset(r_valid.ptr(), 0, track_count);
+	if (!compression.enabled) {
+		return;
+	}
+
+	p_time = CLAMP(p_time, 0, length);
+	int32_t page = _find_compressed_page(p_time);
+	if (page == -1) {
+		return;
+	}
+
+	for (uint32_t i = 0; i < track_count; i++) {
+		const Track *t = tracks[i];
+		switch (t->type) {
+			case TYPE_POSITION_3D: {
+				const PositionTrack *tt = static_cast<const PositionTrack *>(t);
+				Vector3 position;
+				if (tt->compressed_track >= 0 && _pos_scale_interpolate_compressed(tt->compressed_track, p_time, position, page)) {
+					r_values[i] = Vector4(position.x, position.y, position.z, 0);
+					r_valid[i] = true;
+				}
+			} break;
+			case TYPE_ROTATION_3D: {
+				const RotationTrack *rt = static_cast<const RotationTrack *>(t);
+				Quaternion rotation;
+				if (rt->compressed_track >= 0 && _rotation_interpolate_compressed(rt->compressed_track, p_time, rotation, page)) {
+					r_values[i] = Vector4(rotation.x, rotation.y, rotation.z, rotation.w);
+					r_valid[i] = true;
+				}
+			} break;
+			case TYPE_SCALE_3D: {
+				const ScaleTrack *st = static_cast<const ScaleTrack *>(t);
+				Vector3 scale;
+				if (st->compressed_track >= 0 && _pos_scale_interpolate_compressed(st->compressed_track, p_time, scale, page)) {
+					r_values[i] = Vector4(scale.x, scale.y, scale.z, 0);
+					r_valid[i] = true;
+				}
+			} break;
+			case TYPE_BLEND_SHAPE: {
+				const BlendShapeTrack *bst = static_cast<const BlendShapeTrack *>(t);
+				float blend;
+				if (bst->compressed_track >= 0 && _blend_shape_interpolate_compressed(bst->compressed_track, p_time, blend, page)) {
+					r_values[i] = Vector4(blend, 0, 0, 0);
+					r_valid[i] = true;
+				}
+			} break;
+			default: {
+			} break;
+		}
+	}
+}
+
 void Animation::track_set_key_value(int p_track, int p_key_idx, const Variant &p_value) {
 	ERR_FAIL_UNSIGNED_INDEX((uint32_t)p_track, tracks.size());
 	Track *t = tracks[p_track];
@@ -5268,13 +5333,30 @@ void Animation::compress(uint32_t p_page_size, uint32_t p_fps, float p_split_tol
 #endif
 }
 
-bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret) const {
+int32_t Animation::_find_compressed_page(double p_time) const {
+	// Last page starting at or before p_time.
+	int32_t low = 0;
+	int32_t high = int32_t(compression.pages.size()) - 1;
+	int32_t page_index = -1;
+	while (low <= high) {
+		int32_t middle = (low + high) / 2;
+		if (compression.pages[middle].time_offset > p_time) {
+			high = middle - 1;
+		} else {
+			page_index = middle;
+			low = middle + 1;
+		}
+	}
+	return page_index;
+}
+
+bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, double p_time, Quaternion &r_ret, int32_t p_page) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, p_page)) {
 		return false; //some sort of problem
 	}
 
@@ -5292,13 +5374,13 @@ bool Animation::_rotation_interpolate_compressed(uint32_t p_compressed_track, do
 	return true;
 }
 
-bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret) const {
+bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, double p_time, Vector3 &r_ret, int32_t p_page) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<3>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, p_page)) {
 		return false; //some sort of problem
 	}
 
@@ -5315,13 +5397,13 @@ bool Animation::_pos_scale_interpolate_compressed(uint32_t p_compressed_track, d
 
 	return true;
 }
-bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const {
+bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret, int32_t p_page) const {
 	Vector3i current;
 	Vector3i next;
 	double time_current;
 	double time_next;
 
-	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next)) {
+	if (!_fetch_compressed<1>(p_compressed_track, p_time, current, time_current, next, time_next, nullptr, p_page)) {
 		return false; //some sort of problem
 	}
 
@@ -5340,7 +5422,7 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 }
 
 template <uint32_t COMPONENTS>
-bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index, int32_t p_page) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
@@ -5350,13 +5432,7 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 
 	double frame_to_sec = 1.0 / double(compression.fps);
 
-	int32_t page_index = -1;
-	for (uint32_t i = 0; i < compression.pages.size(); i++) {
-		if (compression.pages[i].time_offset > p_time) {
-			break;
-		}
-		page_index = i;
-	}
+	int32_t page_index = p_page >= 0 ? p_page : _find_compressed_page(p_time);
 
 	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
 
@@ -5371,21 +5447,38 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 	double packet_time = double(time_keys[0]) * frame_to_sec + page_base_time;
 	uint32_t base_frame = time_keys[0];
 
-	for (uint32_t i = 1; i < time_key_count; i++) {
-		uint32_t f = time_keys[i * 2 + 0];
-		double frame_time = double(f) * frame_to_sec + page_base_time;
+	if (key_index) {
+		for (uint32_t i = 1; i < time_key_count; i++) {
+			uint32_t f = time_keys[i * 2 + 0];
+			double frame_time = double(f) * frame_to_sec + page_base_time;
 
-		if (frame_time > p_time) {
-			break;
-		}
+			if (frame_time > p_time) {
+				break;
+			}
 
-		if (key_index) {
 			(*key_index) += (time_keys[(i - 1) * 2 + 1] >> 12) + 1;
-		}
 
-		packet_idx = i;
-		packet_time = frame_time;
-		base_frame = f;
+			packet_idx = i;
+			packet_time = frame_time;
+			base_frame = f;
+		}
+	} else {
+		// Key indices are not needed, so binary search the last packet starting at or before p_time.
+		int32_t low = 1;
+		int32_t high = int32_t(time_key_count) - 1;
+		while (low <= high) {
+			int32_t middle = (low + high) / 2;
+			uint32_t f = time_keys[middle * 2 + 0];
+			double frame_time = double(f) * frame_to_sec + page_base_time;
+			if (frame_time > p_time) {
+				high = middle - 1;
+			} else {
+				packet_idx = middle;
+				packet_time = frame_time;
+				base_frame = f;
+				low = middle + 1;
+			}
+		}
 	}
 
 	const uint8_t *data_keys_base = (const uint8_t *)&page_data[indices[p_compressed_track * 3 + 2]];
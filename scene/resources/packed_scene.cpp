@@ -150,6 +150,99 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+const SceneState::InstantiationPlan &SceneState::_get_instantiation_plan() const {
+	if (instantiation_plan_valid.is_set()) {
+		return instantiation_plan;
+	}
+
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan_valid.is_set()) {
+		return instantiation_plan;
+	}
+
+	instantiation_plan.nodes.clear();
+	instantiation_plan.nodes.resize(nodes.size());
+
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::NodePlan &node_plan = instantiation_plan.nodes[i];
+
+		if (i > 0 && n.parent >= 0 && !(n.parent & FLAG_ID_IS_PATH) && n.parent < nodes.size()) {
+			instantiation_plan.nodes[n.parent].child_count++;
+		}
+
+		// Only nodes created by this scene have a class known in advance.
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type == TYPE_INSTANTIATED || n.type < 0 || n.type >= names.size()) {
+			continue;
+		}
+
+		// Same conditions as ClassDB::instantiate() taking the plain creation path, extension and
+		// editor classes keep going through it.
+		const ClassDB::ClassInfo *class_info = ClassDB::classes.getptr(names[n.type]);
+		if (!class_info || class_info->disabled || !class_info->exposed || !class_info->creation_func || class_info->gdextension || class_info->is_runtime || class_info->api == ClassDB::API_EDITOR || class_info->api == ClassDB::API_EDITOR_EXTENSION) {
+			continue;
+		}
+
+		node_plan.creation_func = class_info->creation_func;
+		node_plan.setters.resize(n.properties.size());
+
+		for (int j = 0; j < n.properties.size(); j++) {
+			const int name_idx = n.properties[j].name;
+			if ((name_idx & FLAG_PATH_PROPERTY_IS_NODE) || name_idx >= names.size()) {
+				continue;
+			}
+
+			// Mirrors ClassDB::set_property(), which Object::set() uses for nodes without a script.
+			for (const ClassDB::ClassInfo *check = class_info; check; check = check->inherits_ptr) {
+				const ClassDB::PropertySetGet *psg = check->property_setget.getptr(names[name_idx]);
+				if (psg) {
+					node_plan.setters[j].method = psg->_setptr;
+					node_plan.setters[j].index = psg->index;
+					break;
+				}
+			}
+		}
+	}
+
+	instantiation_plan_valid.set();
+	return instantiation_plan;
+}
+
+void SceneState::_invalidate_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_valid.clear();
+	instantiation_plan.nodes.clear();
+}
+
+void SceneState::_set_planned_property(Node *p_node, const InstantiationPlan::Setter &p_setter, const Variant &p_value) {
+	MethodBind *method = p_setter.method;
+
+	Variant index;
+	const Variant *args[2];
+	int argc = 0;
+	if (p_setter.index >= 0) {
+		index = p_setter.index;
+		args[argc++] = &index;
+	}
+	args[argc++] = &p_value;
+
+	// Validated calls skip argument conversion, so they need every argument to have the exact type.
+	// Objects still go through a regular call, which checks their class.
+	bool validated = !method->is_vararg() && method->get_argument_count() == argc;
+	for (int i = 0; validated && i < argc; i++) {
+		const Variant::Type type = method->get_argument_type(i);
+		validated = type == Variant::NIL || (type == args[i]->get_type() && type != Variant::OBJECT);
+	}
+
+	if (validated) {
+		Variant ret;
+		method->validated_call(p_node, args, &ret);
+	} else {
+		Callable::CallError ce;
+		method->call(p_node, args, argc, ce);
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -197,8 +290,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool deep_search_warned = false;
 
+	const InstantiationPlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		plan = &_get_instantiation_plan();
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const InstantiationPlan::NodePlan *node_plan = plan ? &plan->nodes[i] : nullptr;
+		bool planned_node = false; // Created from the plan, so its class and property setters are known.
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -313,9 +413,15 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			// Node belongs to this scene and must be created.
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			Object *obj = nullptr;
+			if (node_plan && node_plan->creation_func) {
+				obj = node_plan->creation_func(true);
+			} else {
+				obj = ClassDB::instantiate(snames[n.type]);
+			}
 
 			node = Object::cast_to<Node>(obj);
+			planned_node = node && node_plan && node_plan->creation_func;
 
 			if (!node) {
 				if (obj) {
@@ -356,6 +462,9 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			if (i < ids.size()) {
 				node->set_unique_scene_id(ids[i]);
 			}
+			if (planned_node && node_plan->child_count > 0) {
+				node->data.children.reserve(node_plan->child_count);
+			}
 			// may not have found the node (part of instantiated scene and removed)
 			// if found all is good, otherwise ignore
 
@@ -489,7 +598,11 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							if (planned_node && node_plan->setters[j].method && !node->get_script_instance()) {
+								_set_planned_property(node, node_plan->setters[j], value);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1441,6 +1554,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_invalidate_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1645,6 +1759,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_invalidate_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -2297,6 +2413,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_invalidate_instantiation_plan();
 	nodes.push_back(nd);
 
 	ids.push_back(p_unique_id);
@@ -2315,6 +2432,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_invalidate_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -2326,6 +2444,7 @@ void SceneState::add_node_group(int p_node, int p_group) {
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_invalidate_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -2503,6 +2622,67 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+Node *PackedScene::instantiate_pooled() {
+	{
+		MutexLock lock(instance_pool_mutex);
+		while (!instance_pool.is_empty()) {
+			ObjectID id = instance_pool[instance_pool.size() - 1];
+			instance_pool.resize(instance_pool.size() - 1);
+			pooled_instances.erase(id);
+
+			// Skip instances freed while pooled.
+			Node *node = ObjectDB::get_instance<Node>(id);
+			if (node) {
+				return node;
+			}
+		}
+	}
+
+	return instantiate();
+}
+
+void PackedScene::recycle_instance(Node *p_node) {
+	ERR_FAIL_NULL(p_node);
+	ERR_FAIL_COND_MSG(p_node->is_queued_for_deletion(), "Can't recycle an instance queued for deletion.");
+	ERR_FAIL_COND_MSG(!is_built_in() && p_node->get_scene_file_path() != get_path(), vformat("Node \"%s\" is not an instance of scene \"%s\".", p_node->get_name(), get_path()));
+	{
+		MutexLock lock(instance_pool_mutex);
+		ERR_FAIL_COND_MSG(pooled_instances.has(p_node->get_instance_id()), vformat("Node \"%s\" is already in the instance pool.", p_node->get_name()));
+	}
+
+	Node *parent = p_node->get_parent();
+	if (parent) {
+		parent->remove_child(p_node);
+	}
+	p_node->set_owner(nullptr);
+
+	MutexLock lock(instance_pool_mutex);
+	instance_pool.push_back(p_node->get_instance_id());
+	pooled_instances.insert(p_node->get_instance_id());
+}
+
+void PackedScene::clear_instance_pool() {
+	LocalVector<ObjectID> pool;
+	{
+		MutexLock lock(instance_pool_mutex);
+		pool = instance_pool;
+		instance_pool.clear();
+		pooled_instances.clear();
+	}
+
+	for (const ObjectID &id : pool) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int PackedScene::get_pooled_instance_count() const {
+	MutexLock lock(instance_pool_mutex);
+	return instance_pool.size();
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
 	state = p_by;
 	state->set_path(get_path());
@@ -2590,6 +2770,10 @@ void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
+	ClassDB::bind_method(D_METHOD("instantiate_pooled"), &PackedScene::instantiate_pooled);
+	ClassDB::bind_method(D_METHOD("recycle_instance", "node"), &PackedScene::recycle_instance);
+	ClassDB::bind_method(D_METHOD("clear_instance_pool"), &PackedScene::clear_instance_pool);
+	ClassDB::bind_method(D_METHOD("get_pooled_instance_count"), &PackedScene::get_pooled_instance_count);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
 	ClassDB::bind_method(D_METHOD("get_state"), &PackedScene::get_state);
@@ -2605,3 +2789,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	clear_instance_pool();
+}
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/templates/hash_set.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -90,6 +91,31 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Lookups resolved once per scene and reused by runtime instantiations, so nodes owned by
+	// the scene are created and set up without ClassDB queries by name.
+	struct InstantiationPlan {
+		struct Setter {
+			MethodBind *method = nullptr; // Null when the property has to go through Object::set().
+			int index = -1;
+		};
+
+		struct NodePlan {
+			Object *(*creation_func)(bool) = nullptr; // Only set for engine classes.
+			uint32_t child_count = 0;
+			LocalVector<Setter> setters; // Same order as NodeData::properties.
+		};
+
+		LocalVector<NodePlan> nodes;
+	};
+
+	mutable InstantiationPlan instantiation_plan;
+	mutable SafeFlag instantiation_plan_valid;
+	mutable Mutex instantiation_plan_mutex;
+
+	const InstantiationPlan &_get_instantiation_plan() const;
+	void _invalidate_instantiation_plan();
+	static void _set_planned_property(Node *p_node, const InstantiationPlan::Setter &p_setter, const Variant &p_value);
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -247,6 +273,11 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// Instances handed back with recycle_instance(), reused by instantiate_pooled().
+	LocalVector<ObjectID> instance_pool;
+	HashSet<ObjectID> pooled_instances;
+	mutable Mutex instance_pool_mutex;
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -270,6 +301,11 @@ public:
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
 
+	Node *instantiate_pooled();
+	void recycle_instance(Node *p_node);
+	void clear_instance_pool();
+	int get_pooled_instance_count() const;
+
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
 
@@ -289,6 +325,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
@@ -40,6 +40,7 @@ void PhysicsServer2DWrapMT::_thread_exit() {
 }
 
 void PhysicsServer2DWrapMT::_thread_loop() {
+	Memory::TagScope memory_tag(Memory::TAG_PHYSICS);
 	while (!exit) {
 		WorkerThreadPool::get_singleton()->yield();
 
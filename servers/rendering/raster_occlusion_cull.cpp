@@ -0,0 +1,372 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(const LocalVector<ScreenTriangle> &p_triangles, const Projection &p_cam_projection, bool p_cam_orthogonal, const Vector2 &p_jitter) {
+	ERR_FAIL_COND(is_empty());
+
+	RasterThreadData td;
+	td.triangles = p_triangles.ptr();
+	td.triangle_count = p_triangles.size();
+	td.band_count = MIN((uint32_t)sizes[0].y, MAX(1, WorkerThreadPool::get_singleton()->get_thread_count()) * 4u);
+	td.jitter = p_jitter;
+	td.camera_orthogonal = p_cam_orthogonal;
+	td.miss_depth = p_cam_projection.get_z_far() * 1.05f;
+
+	// Corners of the near plane in view space, used to turn depth into distance to the camera.
+	Projection inv_projection = p_cam_projection.inverse();
+	td.near_corner = inv_projection.xform(Vector3(-1, -1, -1));
+	td.near_u_interp = inv_projection.xform(Vector3(1, -1, -1)) - td.near_corner;
+	td.near_v_interp = inv_projection.xform(Vector3(-1, 1, -1)) - td.near_corner;
+
+	debug_tex_range = p_cam_projection.get_z_far();
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_raster_band_threaded, &td, td.band_count, -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_raster_band_threaded(uint32_t p_band, const RasterThreadData *p_data) {
+	// Each band owns a range of rows, so threads never write to the same pixels.
+	const Size2i &buffer_size = sizes[0];
+	int from_y = p_band * buffer_size.y / p_data->band_count;
+	int to_y = (p_band + 1) * buffer_size.y / p_data->band_count;
+	float *depth = mips[0];
+
+	for (int i = from_y * buffer_size.x; i < to_y * buffer_size.x; i++) {
+		depth[i] = FLT_MAX;
+	}
+
+	for (uint32_t i = 0; i < p_data->triangle_count; i++) {
+		const ScreenTriangle &tri = p_data->triangles[i];
+		if (tri.max_y < from_y || tri.min_y >= to_y) {
+			continue;
+		}
+
+		const Vector2 &a = tri.points[0];
+		const Vector2 &b = tri.points[1];
+		const Vector2 &c = tri.points[2];
+
+		int min_x = CLAMP((int)Math::floor(MIN(a.x, MIN(b.x, c.x)) - 1.0f), 0, buffer_size.x - 1);
+		int max_x = CLAMP((int)Math::ceil(MAX(a.x, MAX(b.x, c.x))), 0, buffer_size.x - 1);
+		int min_y = MAX(tri.min_y, from_y);
+		int max_y = MIN(tri.max_y, to_y - 1);
+
+		// Edge functions are positive inside the triangle, as triangles are stored counter-clockwise.
+		float inv_area = 1.0f / (b - a).cross(c - a);
+		float step_x0 = -(c.y - b.y);
+		float step_x1 = -(a.y - c.y);
+		float step_x2 = -(b.y - a.y);
+
+		for (int y = min_y; y <= max_y; y++) {
+			float px = min_x + 0.5f + p_data->jitter.x;
+			float py = y + 0.5f + p_data->jitter.y;
+			float w0 = (c.x - b.x) * (py - b.y) - (c.y - b.y) * (px - b.x);
+			float w1 = (a.x - c.x) * (py - c.y) - (a.y - c.y) * (px - c.x);
+			float w2 = (b.x - a.x) * (py - a.y) - (b.y - a.y) * (px - a.x);
+			float *row = &depth[y * buffer_size.x];
+
+			for (int x = min_x; x <= max_x; x++) {
+				if (w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f) {
+					float d = (w0 * tri.depths[0] + w1 * tri.depths[1] + w2 * tri.depths[2]) * inv_area;
+					if (!p_data->camera_orthogonal) {
+						d = 1.0f / d; // Reciprocal depth is linear in screen space.
+					}
+					row[x] = MIN(row[x], d);
+				}
+				w0 += step_x0;
+				w1 += step_x1;
+				w2 += step_x2;
+			}
+		}
+	}
+
+	// The HZBuffer stores the distance to the camera, like rays hitting the occluders would.
+	for (int y = from_y; y < to_y; y++) {
+		float *row = &depth[y * buffer_size.x];
+		float v = (y + 0.5f) / buffer_size.y;
+		for (int x = 0; x < buffer_size.x; x++) {
+			if (row[x] == FLT_MAX) {
+				row[x] = p_data->miss_depth;
+			} else if (!p_data->camera_orthogonal) {
+				float u = (x + 0.5f) / buffer_size.x;
+				Vector3 near_point = p_data->near_corner + u * p_data->near_u_interp + v * p_data->near_v_interp;
+				row[x] *= near_point.length() / -near_point.z;
+			}
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	// Occluders are transformed when rasterizing, so there is nothing to rebuild here.
+	OccluderInstance &instance = scenario->instances[p_instance];
+	instance.occluder = p_occluder;
+	instance.xform = p_xform;
+	instance.enabled = p_enabled;
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+	scenario->instances.erase(p_instance);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+Vector2 RasterOcclusionCull::_get_jitter() const {
+	if (!_jitter_enabled) {
+		return Vector2();
+	}
+
+	// Same pattern as the raycast implementation, in pixels.
+	static const Vector2 pattern[9] = {
+		Vector2(0, 0),
+		Vector2(-1, -1),
+		Vector2(1, -1),
+		Vector2(-1, 1),
+		Vector2(1, 1),
+		Vector2(-0.5f, -0.5f),
+		Vector2(0.5f, -0.5f),
+		Vector2(-0.5f, 0.5f),
+		Vector2(0.5f, 0.5f),
+	};
+
+	return pattern[Engine::get_singleton()->get_frames_drawn() % 9] * 0.5f * 0.66f;
+}
+
+void RasterOcclusionCull::_add_triangle(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c, const Projection &p_cam_projection, real_t p_z_near, bool p_cam_orthogonal, const Size2i &p_buffer_size) {
+	const Vector3 vertices[3] = { p_a, p_b, p_c };
+	Vector3 clipped[4];
+	int clipped_count = 0;
+
+	for (int i = 0; i < 3; i++) {
+		const Vector3 &current = vertices[i];
+		const Vector3 &next = vertices[(i + 1) % 3];
+		bool current_inside = current.z <= -p_z_near;
+		bool next_inside = next.z <= -p_z_near;
+
+		if (current_inside) {
+			clipped[clipped_count++] = current;
+		}
+		if (current_inside != next_inside) {
+			real_t t = (-p_z_near - current.z) / (next.z - current.z);
+			clipped[clipped_count++] = current.lerp(next, t);
+		}
+	}
+
+	if (clipped_count < 3) {
+		return; // Fully behind the near plane.
+	}
+
+	_add_clipped_triangle(clipped, p_cam_projection, p_cam_orthogonal, p_buffer_size);
+	if (clipped_count == 4) {
+		const Vector3 second[3] = { clipped[0], clipped[2], clipped[3] };
+		_add_clipped_triangle(second, p_cam_projection, p_cam_orthogonal, p_buffer_size);
+	}
+}
+
+void RasterOcclusionCull::_add_clipped_triangle(const Vector3 p_vertices[3], const Projection &p_cam_projection, bool p_cam_orthogonal, const Size2i &p_buffer_size) {
+	ScreenTriangle tri;
+	Vector2 min_point = Vector2(FLT_MAX, FLT_MAX);
+	Vector2 max_point = Vector2(-FLT_MAX, -FLT_MAX);
+
+	for (int i = 0; i < 3; i++) {
+		Vector3 projected = p_cam_projection.xform(p_vertices[i]);
+		tri.points[i] = Vector2((projected.x * 0.5f + 0.5f) * p_buffer_size.x, (projected.y * 0.5f + 0.5f) * p_buffer_size.y);
+		float depth = -p_vertices[i].z;
+		tri.depths[i] = p_cam_orthogonal ? depth : 1.0f / depth;
+		min_point = min_point.min(tri.points[i]);
+		max_point = max_point.max(tri.points[i]);
+	}
+
+	if (max_point.x < -1.0f || max_point.y < -1.0f || min_point.x > p_buffer_size.x + 1.0f || min_point.y > p_buffer_size.y + 1.0f) {
+		return; // Off screen.
+	}
+
+	real_t area = (tri.points[1] - tri.points[0]).cross(tri.points[2] - tri.points[0]);
+	if (Math::is_zero_approx(area)) {
+		return;
+	}
+	if (area < 0) {
+		// Occluders are double-sided, store every triangle counter-clockwise.
+		SWAP(tri.points[1], tri.points[2]);
+		SWAP(tri.depths[1], tri.depths[2]);
+	}
+
+	// Leave one pixel of margin for the jittered sample positions.
+	tri.min_y = CLAMP((int)Math::floor(min_point.y - 1.0f), 0, p_buffer_size.y - 1);
+	tri.max_y = CLAMP((int)Math::ceil(max_point.y), 0, p_buffer_size.y - 1);
+
+	screen_triangles.push_back(tri);
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || buffer->is_empty()) {
+		return;
+	}
+
+	const Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (!scenario) {
+		return;
+	}
+
+	Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+	real_t z_near = p_cam_projection.get_z_near();
+	Size2i buffer_size = buffer->get_occlusion_buffer_size();
+
+	screen_triangles.clear();
+
+	for (const KeyValue<RID, OccluderInstance> &E : scenario->instances) {
+		const OccluderInstance &instance = E.value;
+		if (!instance.enabled) {
+			continue;
+		}
+
+		const Occluder *occluder = occluder_owner.get_or_null(instance.occluder);
+		if (!occluder) {
+			continue;
+		}
+
+		Transform3D view_xform = cam_inv_transform * instance.xform;
+		uint32_t vertex_count = occluder->vertices.size();
+		const Vector3 *vertices = occluder->vertices.ptr();
+		view_vertices.resize(vertex_count);
+		for (uint32_t i = 0; i < vertex_count; i++) {
+			view_vertices[i] = view_xform.xform(vertices[i]);
+		}
+
+		const int32_t *indices = occluder->indices.ptr();
+		int index_count = occluder->indices.size() - occluder->indices.size() % 3;
+		for (int i = 0; i < index_count; i += 3) {
+			uint32_t a = indices[i + 0];
+			uint32_t b = indices[i + 1];
+			uint32_t c = indices[i + 2];
+			if (a >= vertex_count || b >= vertex_count || c >= vertex_count) {
+				continue;
+			}
+			_add_triangle(view_vertices[a], view_vertices[b], view_vertices[c], p_cam_projection, z_near, p_cam_orthogonal, buffer_size);
+		}
+	}
+
+	buffer->rasterize(screen_triangles, p_cam_projection, p_cam_orthogonal, _get_jitter());
+	buffer->update_mips();
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+////////////////////////////////////////////////////////
+
+RasterOcclusionCull::RasterOcclusionCull() {
+	_jitter_enabled = GLOBAL_GET("rendering/occlusion_culling/jitter_projection");
+}
+
+RasterOcclusionCull::~RasterOcclusionCull() {
+	for (const RID &occluder : occluder_owner.get_owned_list()) {
+		free_occluder(occluder);
+	}
+}
@@ -125,7 +125,7 @@ public:
 
 	/* VISIBILITY NOTIFIER API */
 
-	RendererSceneOcclusionCull *dummy_occlusion_culling = nullptr;
+	RendererSceneOcclusionCull *default_occlusion_culling = nullptr; // Replaced as singleton by modules providing their own implementation.
 
 	/* SCENARIO API */
 
@@ -250,6 +250,50 @@ public:
 		}
 	};
 
+	struct InstanceBoundsBlock {
+		// Consecutive instance bounds transposed into one array per bound component,
+		// so frustum tests run over the whole block in loops the compiler can vectorize.
+
+		static constexpr uint32_t SIZE = 64;
+		real_t bounds[6][SIZE];
+		uint32_t count = 0;
+
+		_ALWAYS_INLINE_ void load(const PagedArray<InstanceBounds> &p_bounds, uint64_t p_from, uint32_t p_count) {
+			count = p_count;
+			for (uint32_t i = 0; i < p_count; i++) {
+				const real_t *src = p_bounds[p_from + i].bounds;
+				for (uint32_t j = 0; j < 6; j++) {
+					bounds[j][i] = src[j];
+				}
+			}
+			for (uint32_t i = p_count; i < SIZE; i++) {
+				for (uint32_t j = 0; j < 6; j++) {
+					bounds[j][i] = 0;
+				}
+			}
+		}
+
+		// Same test as InstanceBounds::in_frustum(), bit i is set if instance i may be inside.
+		_ALWAYS_INLINE_ uint64_t in_frustum_mask(const Frustum &p_frustum) const {
+			uint8_t outside[SIZE] = {};
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				const Plane &plane = p_frustum.planes_ptr[i];
+				const real_t *x = bounds[p_frustum.plane_signs_ptr[i].signs[0]];
+				const real_t *y = bounds[p_frustum.plane_signs_ptr[i].signs[1]];
+				const real_t *z = bounds[p_frustum.plane_signs_ptr[i].signs[2]];
+				for (uint32_t j = 0; j < SIZE; j++) {
+					outside[j] |= (plane.normal.x * x[j] + plane.normal.y * y[j] + plane.normal.z * z[j] - plane.d) >= 0.0;
+				}
+			}
+
+			uint64_t mask = 0;
+			for (uint32_t j = 0; j < count; j++) {
+				mask |= uint64_t(outside[j] == 0) << j;
+			}
+			return mask;
+		}
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
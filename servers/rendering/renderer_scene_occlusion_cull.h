@@ -235,11 +235,31 @@ public:
 
 	virtual void set_build_quality(RS::ViewportOcclusionCullingBuildQuality p_quality) {}
 
+	// Makes this backend the singleton in place of the current one (e.g. the raster fallback created by
+	// the rendering server), which becomes the singleton again once this one is freed.
+	void replace_singleton() {
+		if (singleton != this) {
+			replaced_singleton = singleton;
+			singleton = this;
+		}
+	}
+
 	RendererSceneOcclusionCull() {
-		singleton = this;
+		// Only the first one becomes the singleton implicitly, so standalone instances (e.g. in tests)
+		// don't replace the server's. Other backends call replace_singleton().
+		if (!singleton) {
+			singleton = this;
+		}
 	}
 
 	virtual ~RendererSceneOcclusionCull() {
-		singleton = nullptr;
+		if (singleton == this) {
+			singleton = replaced_singleton;
+		} else if (singleton && singleton->replaced_singleton == this) {
+			singleton->replaced_singleton = replaced_singleton;
+		}
 	}
+
+private:
+	RendererSceneOcclusionCull *replaced_singleton = nullptr;
 };
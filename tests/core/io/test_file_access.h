@@ -31,6 +31,9 @@
 #pragma once
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
+#include "core/os/os.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -248,4 +251,184 @@ TEST_CASE("[FileAccess] Get/Store floating point half precision values") {
 	}
 }
 
+TEST_CASE("[FileAccess] Map read-only") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("testdata.csv"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	uint64_t mapped_size = 0;
+	const uint8_t *mapped = f->map_read_only(mapped_size);
+	if (!mapped) {
+		return; // Not supported on this platform.
+	}
+
+	const Vector<uint8_t> contents = f->get_buffer(f->get_length());
+	CHECK(mapped_size == (uint64_t)contents.size());
+	CHECK(memcmp(mapped, contents.ptr(), contents.size()) == 0);
+
+	// Mapping again returns the existing mapping.
+	uint64_t mapped_size_again = 0;
+	CHECK(f->map_read_only(mapped_size_again) == mapped);
+	CHECK(mapped_size_again == mapped_size);
+}
+
+TEST_CASE("[FileAccess] Get buffer view") {
+	const uint8_t data[] = { 1, 2, 3, 4, 5, 6 };
+	Ref<FileAccessMemory> f;
+	f.instantiate();
+	REQUIRE(f->open_custom(data, sizeof(data)) == OK);
+
+	const Span<uint8_t> first = f->get_buffer_view(4);
+	CHECK(first.ptr() == data);
+	CHECK(first.size() == 4);
+	CHECK(f->get_position() == 4);
+
+	const Span<uint8_t> rest = f->get_buffer_view(10);
+	CHECK(rest.ptr() == data + 4);
+	CHECK(rest.size() == 2);
+	CHECK(f->get_position() == 6);
+}
+
+TEST_CASE("[FileAccess] Compressed with a trained Zstd dictionary") {
+	// Small resource-like files sharing most of their structure.
+	Vector<Vector<uint8_t>> samples;
+	for (int i = 0; i < 200; i++) {
+		const CharString text = vformat("[gd_resource type=\"StandardMaterial3D\" format=3 uid=\"uid://sample%d\"]\n\n[resource]\nresource_name = \"Material%d\"\nalbedo_color = Color(%d, 0.5, 0.25, 1)\nmetallic = 0.%d\nroughness = 0.75\n", i, i, i % 2, i).utf8();
+		Vector<uint8_t> sample;
+		sample.resize(text.length());
+		memcpy(sample.ptrw(), text.get_data(), text.length());
+		samples.push_back(sample);
+	}
+
+	const Vector<uint8_t> dictionary = Compression::train_zstd_dictionary(samples, 4096);
+	REQUIRE(!dictionary.is_empty());
+	CHECK(dictionary.size() <= 4096);
+
+	const uint32_t id = Compression::get_zstd_dictionary_id(dictionary);
+	CHECK(id != 0);
+	CHECK(id <= Compression::ZSTD_DICTIONARY_ID_MAX);
+	REQUIRE(Compression::register_zstd_dictionary(id, dictionary) == OK);
+	CHECK(Compression::has_zstd_dictionary(id));
+
+	// Registering the same bytes again is allowed, different ones under the same ID aren't.
+	CHECK(Compression::register_zstd_dictionary(id, dictionary) == OK);
+	Vector<uint8_t> other_dictionary = dictionary;
+	other_dictionary.write[0] ^= 0xFF;
+	ERR_PRINT_OFF;
+	CHECK(Compression::register_zstd_dictionary(id, other_dictionary) == ERR_ALREADY_EXISTS);
+	ERR_PRINT_ON;
+
+	// The dictionary must pay off on content that wasn't part of the training set.
+	const CharString text = String("[gd_resource type=\"StandardMaterial3D\" format=3 uid=\"uid://unseen\"]\n\n[resource]\nresource_name = \"Unseen\"\nalbedo_color = Color(1, 0.5, 0.25, 1)\nmetallic = 0.42\nroughness = 0.75\n").utf8();
+	const int64_t text_size = text.length();
+	Vector<uint8_t> compressed;
+	compressed.resize(Compression::get_max_compressed_buffer_size(text_size));
+	const int64_t plain_size = Compression::compress(compressed.ptrw(), (const uint8_t *)text.get_data(), text_size);
+	const int64_t dictionary_size = Compression::compress(compressed.ptrw(), (const uint8_t *)text.get_data(), text_size, Compression::MODE_ZSTD, id);
+	REQUIRE(dictionary_size > 0);
+	CHECK(dictionary_size < plain_size);
+
+	Vector<uint8_t> decompressed;
+	decompressed.resize(text_size);
+	CHECK(Compression::decompress(decompressed.ptrw(), text_size, compressed.ptr(), dictionary_size, Compression::MODE_ZSTD, id) == text_size);
+	CHECK(memcmp(decompressed.ptr(), text.get_data(), text_size) == 0);
+
+	// Frames compressed with a dictionary carry a checksum, so decompressing them with another one fails.
+	Vector<uint8_t> wrong_dictionary = dictionary;
+	for (int i = 0; i < wrong_dictionary.size(); i++) {
+		wrong_dictionary.write[i] ^= 0xFF;
+	}
+	const uint32_t wrong_id = (id % Compression::ZSTD_DICTIONARY_ID_MAX) + 1;
+	REQUIRE(Compression::register_zstd_dictionary(wrong_id, wrong_dictionary) == OK);
+	CHECK(Compression::decompress(decompressed.ptrw(), text_size, compressed.ptr(), dictionary_size, Compression::MODE_ZSTD, wrong_id) == -1);
+	Compression::unregister_zstd_dictionary(wrong_id);
+
+	// Round trip through FileAccessCompressed, which records the dictionary in its header.
+	const String path = TestUtils::get_temp_path("compressed_with_dictionary.bin");
+	{
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("GCPF", Compression::MODE_ZSTD, 4096, id);
+		REQUIRE(fac->open_internal(path, FileAccess::WRITE) == OK);
+		fac->store_buffer((const uint8_t *)text.get_data(), text_size);
+		fac->close();
+	}
+	{
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("GCPF");
+		REQUIRE(fac->open_internal(path, FileAccess::READ) == OK);
+		CHECK(fac->get_length() == (uint64_t)text_size);
+		Vector<uint8_t> data;
+		data.resize(text_size);
+		CHECK(fac->get_buffer(data.ptrw(), text_size) == (uint64_t)text_size);
+		CHECK(memcmp(data.ptr(), text.get_data(), text_size) == 0);
+	}
+
+	Compression::unregister_zstd_dictionary(id);
+	CHECK_FALSE(Compression::has_zstd_dictionary(id));
+	{
+		Ref<FileAccessCompressed> fac;
+		fac.instantiate();
+		fac->configure("GCPF");
+		ERR_PRINT_OFF;
+		CHECK(fac->open_internal(path, FileAccess::READ) == ERR_FILE_UNRECOGNIZED);
+		ERR_PRINT_ON;
+	}
+}
+
+// Compares decompressing small files with and without a dictionary.
+// Run with `--test --no-skip --test-case="*Benchmark*"`.
+TEST_CASE("[FileAccess][Benchmark] Zstd dictionary decompression" * doctest::skip()) {
+	Vector<Vector<uint8_t>> samples;
+	for (int i = 0; i < 2000; i++) {
+		const CharString text = vformat("[gd_resource type=\"StandardMaterial3D\" format=3 uid=\"uid://sample%d\"]\n\n[resource]\nresource_name = \"Material%d\"\nalbedo_color = Color(%d, 0.5, 0.25, 1)\nmetallic = 0.%d\nroughness = 0.75\n", i, i, i % 2, i).utf8();
+		Vector<uint8_t> sample;
+		sample.resize(text.length());
+		memcpy(sample.ptrw(), text.get_data(), text.length());
+		samples.push_back(sample);
+	}
+
+	const Vector<uint8_t> dictionary = Compression::train_zstd_dictionary(samples, 4096);
+	REQUIRE(!dictionary.is_empty());
+	const uint32_t id = Compression::get_zstd_dictionary_id(dictionary);
+	REQUIRE(Compression::register_zstd_dictionary(id, dictionary) == OK);
+
+	const OS *os = OS::get_singleton();
+	const int rounds = 50;
+
+	for (const uint32_t dictionary_id : { uint32_t(0), id }) {
+		Vector<Vector<uint8_t>> compressed;
+		int64_t compressed_size = 0;
+		for (const Vector<uint8_t> &sample : samples) {
+			Vector<uint8_t> buffer;
+			buffer.resize(Compression::get_max_compressed_buffer_size(sample.size()));
+			const int64_t size = Compression::compress(buffer.ptrw(), sample.ptr(), sample.size(), Compression::MODE_ZSTD, dictionary_id);
+			REQUIRE(size > 0);
+			buffer.resize(size);
+			compressed.push_back(buffer);
+			compressed_size += size;
+		}
+
+		Vector<uint8_t> decompressed;
+		decompressed.resize(4096);
+		int64_t decompressed_size = 0;
+		const uint64_t begin = os->get_ticks_usec();
+		for (int round = 0; round < rounds; round++) {
+			for (int i = 0; i < compressed.size(); i++) {
+				decompressed_size += Compression::decompress(decompressed.ptrw(), decompressed.size(), compressed[i].ptr(), compressed[i].size(), Compression::MODE_ZSTD, dictionary_id);
+			}
+		}
+		const uint64_t usec = os->get_ticks_usec() - begin;
+
+		int64_t sample_size = 0;
+		for (const Vector<uint8_t> &sample : samples) {
+			sample_size += sample.size();
+		}
+		CHECK(decompressed_size == sample_size * rounds);
+		MESSAGE(vformat("%s: %d files, %d bytes compressed to %d. Decompressed %d times in %d ms.", dictionary_id == 0 ? "No dictionary" : "Dictionary", samples.size(), sample_size, compressed_size, rounds, usec / 1000));
+	}
+
+	Compression::unregister_zstd_dictionary(id);
+}
+
 } // namespace TestFileAccess
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/json.h"
+#include "core/os/os.h"
 
 #include "thirdparty/doctest/doctest.h"
 
@@ -423,4 +424,154 @@ TEST_CASE("[JSON] Serialization") {
 		}
 	}
 }
+
+TEST_CASE("[JSON] Parsing UTF-8 buffers") {
+	// Both parsers must accept and reject the same documents, with the same results.
+	const String documents[] = {
+		"null",
+		"-12.5e2",
+		R"({"name": "Godot Engine", "tags": ["ゲーム", "エンジン", "🤖"], "nested": {"empty": [], "value": false}})",
+		"\"Escapes: \\\" \\\\ \\/ \\b \\f \\n \\r \\t \\u00e9 \\ud83e\\udd16\"",
+		"[1, 2,\n3,\n\"multi\nline\"]",
+		"[1 2]",
+		"{\"key\" 1}",
+		"\n\n{\"a\": tru}",
+		"\"\\ud800\"",
+		"[[[",
+		"1 2",
+		"",
+	};
+
+	JSON json;
+	JSON json_utf8;
+	ERR_PRINT_OFF;
+	for (const String &document : documents) {
+		const Error err = json.parse(document);
+		const Error err_utf8 = json_utf8.parse_utf8_buffer(document.to_utf8_buffer());
+		CHECK_MESSAGE(err == err_utf8, vformat("Parsing `%s` as UTF-8 should return the same error.", document));
+		CHECK_MESSAGE(json.get_error_line() == json_utf8.get_error_line(), vformat("Parsing `%s` as UTF-8 should report the same error line.", document));
+		CHECK_MESSAGE(json.get_error_message() == json_utf8.get_error_message(), vformat("Parsing `%s` as UTF-8 should report the same error message.", document));
+		if (err == OK) {
+			CHECK_MESSAGE(json.get_data() == json_utf8.get_data(), vformat("Parsing `%s` as UTF-8 should return the same data.", document));
+		}
+	}
+	ERR_PRINT_ON;
+
+	// Byte order marks are skipped.
+	Vector<uint8_t> bom_buffer = { 0xef, 0xbb, 0xbf, '[', '1', ']' };
+	CHECK(json_utf8.parse_utf8_buffer(bom_buffer) == OK);
+	CHECK(json_utf8.get_data() == Variant(Array({ 1.0 })));
+}
+
+TEST_CASE("[JSON] Stringify to UTF-8 buffers") {
+	Dictionary dictionary;
+	dictionary["name"] = "Godot Engine 🤖";
+	dictionary["escapes"] = "\\\b\f\n\r\t\v\"";
+	dictionary["numbers"] = Array({ 0, -42, 0.5, 1e300, Math::INF });
+	dictionary["nested"] = Dictionary({ { "empty_array", Array() }, { "empty_dictionary", Dictionary() }, { "null", Variant() } });
+	dictionary["vector"] = Vector2(1, 2);
+
+	for (const String &indent : { String(), String("\t") }) {
+		for (const bool full_precision : { false, true }) {
+			CHECK(JSON::stringify_to_utf8_buffer(dictionary, indent, true, full_precision) == JSON::stringify(dictionary, indent, true, full_precision).to_utf8_buffer());
+		}
+	}
+	CHECK(JSON::stringify_to_utf8_buffer(Variant()) == String("null").to_utf8_buffer());
+}
+
+TEST_CASE("[JSON] Parsing UTF-8 events") {
+	class CountingHandler : public JSON::EventHandler {
+	public:
+		int objects = 0;
+		int arrays = 0;
+		int values = 0;
+		LocalVector<String> keys;
+		int stop_after_values = -1;
+
+		virtual bool begin_object() override {
+			objects++;
+			return true;
+		}
+		virtual bool object_key(const Span<char> &p_key) override {
+			keys.push_back(String::utf8(p_key));
+			return true;
+		}
+		virtual bool end_object() override { return true; }
+		virtual bool begin_array() override {
+			arrays++;
+			return true;
+		}
+		virtual bool end_array() override { return true; }
+		virtual bool null_value() override { return _value(); }
+		virtual bool bool_value(bool p_value) override { return _value(); }
+		virtual bool number_value(double p_value) override { return _value(); }
+		virtual bool string_value(const Span<char> &p_value) override { return _value(); }
+
+		bool _value() {
+			values++;
+			return values != stop_after_values;
+		}
+	};
+
+	const CharString document = R"({"a": [1, 2, {"b\u00e9": null}], "c": "text", "d": true})";
+	const Span<uint8_t> buffer((const uint8_t *)document.get_data(), document.length());
+
+	CountingHandler handler;
+	CHECK(JSON::parse_utf8_events(buffer, handler) == OK);
+	CHECK(handler.objects == 2);
+	CHECK(handler.arrays == 1);
+	CHECK(handler.values == 5);
+	REQUIRE(handler.keys.size() == 4);
+	CHECK(handler.keys[0] == "a");
+	CHECK(handler.keys[1] == U"bé");
+	CHECK(handler.keys[2] == "c");
+	CHECK(handler.keys[3] == "d");
+
+	CountingHandler stopping_handler;
+	stopping_handler.stop_after_values = 2;
+	String err_str;
+	CHECK(JSON::parse_utf8_events(buffer, stopping_handler, &err_str) == ERR_SKIP);
+	CHECK(stopping_handler.values == 2);
+	CHECK(!err_str.is_empty());
+}
+
+// Compares the UTF-8 code paths with the String based ones.
+// Run with `--test --no-skip --test-case="*Benchmark*"`.
+TEST_CASE("[JSON][Benchmark] UTF-8 parser and serializer" * doctest::skip()) {
+	Array items;
+	for (int i = 0; i < 100000; i++) {
+		Dictionary item;
+		item["id"] = i;
+		item["name"] = vformat("Item number %d", i);
+		item["position"] = Array({ i * 0.5, i * 0.25, -i * 1.5 });
+		item["tags"] = Array({ "saved", "ünïcödé", "line\nbreak" });
+		item["active"] = i % 2 == 0;
+		items.push_back(item);
+	}
+
+	const OS *os = OS::get_singleton();
+
+	uint64_t begin = os->get_ticks_usec();
+	const String text = JSON::stringify(items);
+	const uint64_t stringify_usec = os->get_ticks_usec() - begin;
+
+	begin = os->get_ticks_usec();
+	const Vector<uint8_t> buffer = JSON::stringify_to_utf8_buffer(items);
+	const uint64_t stringify_utf8_usec = os->get_ticks_usec() - begin;
+
+	// Separate objects, so neither timing includes freeing the other's result.
+	JSON json;
+	begin = os->get_ticks_usec();
+	CHECK(json.parse(String::utf8((const char *)buffer.ptr(), buffer.size())) == OK);
+	const uint64_t parse_usec = os->get_ticks_usec() - begin;
+
+	JSON json_utf8;
+	begin = os->get_ticks_usec();
+	CHECK(json_utf8.parse_utf8_buffer(buffer) == OK);
+	const uint64_t parse_utf8_usec = os->get_ticks_usec() - begin;
+
+	CHECK(buffer == text.to_utf8_buffer());
+	CHECK(json_utf8.get_data() == json.get_data());
+	MESSAGE(vformat("%d MiB of JSON. Stringify: %d ms, UTF-8: %d ms. Parse from UTF-8 bytes: %d ms, UTF-8 parser: %d ms.", buffer.size() / (1024 * 1024), stringify_usec / 1000, stringify_utf8_usec / 1000, parse_usec / 1000, parse_utf8_usec / 1000));
+}
 } // namespace TestJSON
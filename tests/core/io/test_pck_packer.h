@@ -116,4 +116,116 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+
+TEST_CASE("[PCKPacker] Pack compressed and duplicate files") {
+	// Compressible content spanning several compression blocks.
+	String text;
+	for (int i = 0; i < 20000; i++) {
+		text += vformat("Line %d of a compressible file.\n", i);
+	}
+	const CharString text_utf8 = text.utf8();
+	const uint64_t text_size = text_utf8.length();
+
+	const String source_path = TestUtils::get_temp_path("pck_compressed_source.txt");
+	{
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer((const uint8_t *)text_utf8.get_data(), text_size);
+	}
+
+	PCKPacker pck_packer;
+	pck_packer.set_compression_enabled(true);
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	CHECK(pck_packer.add_file("pck_compressed/a.txt", source_path) == OK);
+	CHECK(pck_packer.add_file("pck_compressed/copy/b.txt", source_path) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	{
+		Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ);
+		REQUIRE(f.is_valid());
+		CHECK_MESSAGE(
+				f->get_length() < text_size / 2,
+				"The PCK should hold a single compressed copy of the duplicated file.");
+	}
+
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+
+	for (const String &path : { String("res://pck_compressed/a.txt"), String("res://pck_compressed/copy/b.txt") }) {
+		Ref<FileAccess> f = PackedData::get_singleton()->try_open_path(path);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == text_size);
+
+		Vector<uint8_t> data = f->get_buffer(text_size);
+		CHECK(data.size() == (int64_t)text_size);
+		CHECK(memcmp(data.ptr(), text_utf8.get_data(), text_size) == 0);
+		CHECK(f->eof_reached() == false);
+
+		// Seeking backwards and into the middle of a block.
+		const uint64_t ofs = 70000;
+		f->seek(ofs);
+		uint8_t buf[64];
+		CHECK(f->get_buffer(buf, 64) == 64);
+		CHECK(memcmp(buf, text_utf8.get_data() + ofs, 64) == 0);
+	}
+
+	PackedData::get_singleton()->remove_path("pck_compressed/a.txt");
+	PackedData::get_singleton()->remove_path("pck_compressed/copy/b.txt");
+}
+
+TEST_CASE("[PCKPacker] Pack compressed files with a Zstd dictionary") {
+	Vector<String> source_paths;
+	Vector<CharString> contents;
+	for (int i = 0; i < 64; i++) {
+		const CharString text = vformat("[remap]\n\nimporter=\"texture\"\ntype=\"CompressedTexture2D\"\nuid=\"uid://texture%d\"\npath=\"res://.godot/imported/icon%d.png-%d.ctex\"\n\n[deps]\n\nsource_file=\"res://icon%d.png\"\n", i, i, i * 7919, i).utf8();
+		const String source_path = TestUtils::get_temp_path(vformat("pck_dictionary_source%d.import", i));
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_buffer((const uint8_t *)text.get_data(), text.length());
+		source_paths.push_back(source_path);
+		contents.push_back(text);
+	}
+
+	const Vector<uint8_t> dictionary = PCKPacker::train_zstd_dictionary(source_paths, 4096);
+	REQUIRE(!dictionary.is_empty());
+
+	PCKPacker pck_packer;
+	pck_packer.set_compression_enabled(true);
+	pck_packer.set_zstd_dictionary(dictionary);
+	const String output_pck_path = TestUtils::get_temp_path("output_dictionary.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	for (int i = 0; i < source_paths.size(); i++) {
+		CHECK(pck_packer.add_file(vformat("pck_dictionary/%d.import", i), source_paths[i]) == OK);
+	}
+	CHECK(pck_packer.flush() == OK);
+
+	// A pack whose dictionary can't be registered isn't loaded at all.
+	const uint32_t id = Compression::get_zstd_dictionary_id(dictionary);
+	Compression::unregister_zstd_dictionary(id);
+	Vector<uint8_t> other_dictionary = dictionary;
+	other_dictionary.write[0] ^= 0xFF;
+	REQUIRE(Compression::register_zstd_dictionary(id, other_dictionary) == OK);
+	ERR_PRINT_OFF;
+	CHECK(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == ERR_FILE_UNRECOGNIZED);
+	ERR_PRINT_ON;
+	CHECK_FALSE(PackedData::get_singleton()->has_path("res://pck_dictionary/0.import"));
+	Compression::unregister_zstd_dictionary(id);
+
+	// The dictionary is stored in the pack and registered again when it's loaded.
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+	CHECK(Compression::has_zstd_dictionary(id));
+
+	for (int i = 0; i < contents.size(); i++) {
+		Ref<FileAccess> f = PackedData::get_singleton()->try_open_path(vformat("res://pck_dictionary/%d.import", i));
+		REQUIRE(f.is_valid());
+		const uint64_t size = contents[i].length();
+		CHECK(f->get_length() == size);
+		const Vector<uint8_t> data = f->get_buffer(size);
+		REQUIRE(data.size() == (int64_t)size);
+		CHECK(memcmp(data.ptr(), contents[i].get_data(), size) == 0);
+
+		PackedData::get_singleton()->remove_path(vformat("pck_dictionary/%d.import", i));
+	}
+	PackedData::get_singleton()->remove_path(vformat(PACK_ZSTD_DICTIONARY_DIR "%d.zdict", id));
+}
 } // namespace TestPCKPacker
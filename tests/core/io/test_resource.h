@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "scene/main/node.h"
@@ -627,4 +628,50 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+
+TEST_CASE("[Resource] Loading binary resources with sub-resources decoded in parallel") {
+	// Enough sub-resources for the binary loader to decode them on several threads.
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Array children;
+	Ref<Resource> previous;
+	for (int i = 0; i < 64; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		child->set_meta("values", PackedInt32Array({ i, i * 2, i * 3 }));
+		if (previous.is_valid()) {
+			child->set_meta("previous", previous);
+		}
+		children.push_back(child);
+		previous = child;
+	}
+	resource->set_meta("children", children);
+
+	const String save_path_binary = TestUtils::get_temp_path("resource_parallel.res");
+	REQUIRE(ResourceSaver::save(resource, save_path_binary) == OK);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+	for (bool use_sub_threads : { false, true }) {
+		Error err = FAILED;
+		const Ref<Resource> loaded = loader->load(save_path_binary, "", &err, use_sub_threads, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+		REQUIRE(err == OK);
+		REQUIRE(loaded.is_valid());
+		CHECK(loaded->get_name() == "Root");
+
+		const Array loaded_children = loaded->get_meta("children");
+		REQUIRE(loaded_children.size() == 64);
+		for (int i = 0; i < 64; i++) {
+			const Ref<Resource> child = loaded_children[i];
+			REQUIRE(child.is_valid());
+			CHECK(child->get_name() == vformat("Child %d", i));
+			CHECK(PackedInt32Array(child->get_meta("values")) == PackedInt32Array({ i, i * 2, i * 3 }));
+			if (i > 0) {
+				CHECK_MESSAGE(
+						Ref<Resource>(child->get_meta("previous")) == Ref<Resource>(loaded_children[i - 1]),
+						"References between sub-resources should point to the loaded instances.");
+			}
+		}
+	}
+}
 } // namespace TestResource
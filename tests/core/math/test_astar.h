@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
 
 #include "tests/test_macros.h"
 
@@ -84,6 +85,81 @@ TEST_CASE("[AStar3D] ABCX path") {
 	CHECK(path[3] == ABCX::C);
 }
 
+TEST_CASE("[AStar3D] Moving points after solving") {
+	// Two routes from A to D, through B or C. Costs come from the point positions.
+	AStar3D a;
+	a.add_point(0, Vector3(0, 0, 0));
+	a.add_point(1, Vector3(1, 1, 0));
+	a.add_point(2, Vector3(1, -3, 0));
+	a.add_point(3, Vector3(2, 0, 0));
+	a.connect_points(0, 1);
+	a.connect_points(1, 3);
+	a.connect_points(0, 2);
+	a.connect_points(2, 3);
+
+	Vector<int64_t> path = a.get_id_path(0, 3);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == 1);
+
+	// Positions are updated in the solve graph without rebuilding it.
+	a.set_point_position(1, Vector3(1, 5, 0));
+	path = a.get_id_path(0, 3);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == 2);
+
+	a.add_point(2, Vector3(1, -8, 0));
+	path = a.get_id_path(0, 3);
+	REQUIRE(path.size() == 3);
+	CHECK(path[1] == 1);
+}
+
+TEST_CASE("[AStar3D] Batched id paths") {
+	// A grid with some disabled points, so paths have to go around them.
+	const int grid_size = 24;
+	AStar3D a;
+	for (int y = 0; y < grid_size; y++) {
+		for (int x = 0; x < grid_size; x++) {
+			a.add_point(y * grid_size + x, Vector3(x, y, 0));
+			if (x > 0) {
+				a.connect_points(y * grid_size + x, y * grid_size + x - 1);
+			}
+			if (y > 0) {
+				a.connect_points(y * grid_size + x, (y - 1) * grid_size + x);
+			}
+		}
+	}
+	for (int y = 2; y < grid_size; y++) {
+		a.set_point_disabled(y * grid_size + grid_size / 2);
+	}
+
+	Math::seed(0);
+	PackedInt64Array from_ids;
+	PackedInt64Array to_ids;
+	for (int i = 0; i < 64; i++) {
+		from_ids.push_back(Math::rand() % (grid_size * grid_size));
+		to_ids.push_back(Math::rand() % (grid_size * grid_size));
+	}
+
+	TypedArray<PackedInt64Array> paths = a.get_id_paths(from_ids, to_ids);
+	REQUIRE(paths.size() == from_ids.size());
+	for (int i = 0; i < from_ids.size(); i++) {
+		CHECK(PackedInt64Array(paths[i]) == a.get_id_path(from_ids[i], to_ids[i]));
+	}
+
+	// Disabling points updates the solve graph in place.
+	const int64_t corner = grid_size * grid_size - 1;
+	CHECK(a.get_id_path(0, corner).size() == 2 * grid_size - 1);
+	a.set_point_disabled(grid_size / 2);
+	a.set_point_disabled(grid_size + grid_size / 2);
+	CHECK(a.get_id_path(0, corner).is_empty());
+	a.set_point_disabled(grid_size / 2, false);
+	CHECK(a.get_id_path(0, corner).size() == 2 * grid_size - 1);
+
+	// Removing a point rebuilds it.
+	a.remove_point(grid_size / 2);
+	CHECK(a.get_id_path(0, corner).is_empty());
+}
+
 TEST_CASE("[AStar3D] Add/Remove") {
 	AStar3D a;
 
@@ -211,4 +287,74 @@ TEST_CASE("[AStar3D] Add/Remove") {
 	}
 	// It's been great work, cheers. \(^ ^)/
 }
+
+TEST_CASE("[AStarGrid2D] Flow field") {
+	Ref<AStarGrid2D> grid;
+	grid.instantiate();
+	grid->set_region(Rect2i(0, 0, 10, 10));
+	grid->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	grid->set_default_compute_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	grid->update();
+
+	TypedArray<Vector2i> goals;
+	goals.push_back(Vector2i(0, 0));
+	grid->set_flow_field_goals(goals);
+	grid->update_flow_field();
+
+	CHECK(grid->get_flow_field_costs().size() == 100);
+	CHECK(grid->get_flow_field_cost(Vector2i(0, 0)) == 0);
+	CHECK(grid->get_flow_field_cost(Vector2i(9, 9)) == 18);
+	CHECK(grid->get_flow_field_next_id(Vector2i(0, 0)) == Vector2i(0, 0));
+	CHECK(grid->get_flow_field_directions()[0] == Vector2());
+
+	// Following the field leads to the goal, one unit of cost per step.
+	Vector2i id = Vector2i(9, 9);
+	int steps = 0;
+	while (id != Vector2i(0, 0) && steps < 100) {
+		Vector2i next = grid->get_flow_field_next_id(id);
+		CHECK(grid->get_flow_field_cost(next) == grid->get_flow_field_cost(id) - 1);
+		id = next;
+		steps++;
+	}
+	CHECK(steps == 18);
+
+	// Incremental updates must match a field computed from scratch.
+	Ref<AStarGrid2D> reference;
+	reference.instantiate();
+	reference->set_region(Rect2i(0, 0, 10, 10));
+	reference->set_diagonal_mode(AStarGrid2D::DIAGONAL_MODE_NEVER);
+	reference->set_default_compute_heuristic(AStarGrid2D::HEURISTIC_MANHATTAN);
+	reference->update();
+	reference->set_flow_field_goals(goals);
+
+	grid->fill_solid_region(Rect2i(5, 0, 1, 9));
+	reference->fill_solid_region(Rect2i(5, 0, 1, 9));
+	grid->update_flow_field();
+	reference->update_flow_field();
+	CHECK(grid->get_flow_field_cost(Vector2i(9, 0)) == 27);
+	CHECK(grid->get_flow_field_cost(Vector2i(5, 0)) == Math::INF);
+	CHECK(grid->get_flow_field_costs() == reference->get_flow_field_costs());
+
+	grid->set_point_weight_scale(Vector2i(5, 9), 4);
+	reference->set_point_weight_scale(Vector2i(5, 9), 4);
+	reference->set_flow_field_goals(goals);
+	grid->update_flow_field();
+	reference->update_flow_field();
+	CHECK(grid->get_flow_field_cost(Vector2i(9, 0)) == 30);
+	CHECK(grid->get_flow_field_costs() == reference->get_flow_field_costs());
+
+	grid->set_point_solid(Vector2i(5, 9));
+	reference->set_point_solid(Vector2i(5, 9));
+	reference->set_flow_field_goals(goals);
+	grid->update_flow_field();
+	reference->update_flow_field();
+	CHECK(grid->get_flow_field_cost(Vector2i(9, 0)) == Math::INF);
+	CHECK(grid->get_flow_field_next_id(Vector2i(9, 0)) == Vector2i(9, 0));
+	CHECK(grid->get_flow_field_costs() == reference->get_flow_field_costs());
+
+	grid->fill_solid_region(Rect2i(5, 0, 1, 10), false);
+	grid->update_flow_field();
+	CHECK(grid->get_flow_field_cost(Vector2i(9, 0)) == 9);
+	CHECK(grid->get_flow_field_cost(Vector2i(9, 9)) == 18);
+}
 } // namespace TestAStar
@@ -33,6 +33,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include "tests/test_macros.h"
 
@@ -455,6 +456,31 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Emitting should follow connection changes between emissions") {
+		GDREGISTER_CLASS(_TestDerivedObject);
+		_TestDerivedObject target;
+		_TestDerivedObject one_shot_target;
+		target.set_property(0);
+		one_shot_target.set_property(0);
+
+		object.connect("my_custom_signal", Callable(&target, "set_property"));
+		object.emit_signal("my_custom_signal", 1);
+		CHECK(target.get_property() == 1);
+
+		object.connect("my_custom_signal", Callable(&one_shot_target, "set_property"), Object::CONNECT_ONE_SHOT);
+		object.emit_signal("my_custom_signal", 2);
+		CHECK(target.get_property() == 2);
+		CHECK(one_shot_target.get_property() == 2);
+
+		object.emit_signal("my_custom_signal", 3);
+		CHECK(target.get_property() == 3);
+		CHECK(one_shot_target.get_property() == 2);
+
+		object.disconnect("my_custom_signal", Callable(&target, "set_property"));
+		object.emit_signal("my_custom_signal", 4);
+		CHECK(target.get_property() == 3);
+	}
 }
 
 class NotificationObjectSuperclass : public Object {
@@ -634,4 +660,108 @@ TEST_CASE("[Object] RequiredResult") {
 	CHECK_EQ(ref, var);
 }
 
+struct ObjectChurn {
+	static constexpr uint32_t THREAD_COUNT = 4;
+	static constexpr uint32_t OBJECT_COUNT = 1000;
+
+	LocalVector<Object *> objects[THREAD_COUNT];
+	SafeNumeric<uint32_t> next_index;
+	std::atomic<uint32_t> failures = 0;
+
+	static void create(void *p_data) {
+		ObjectChurn *churn = (ObjectChurn *)p_data;
+		LocalVector<Object *> &objects = churn->objects[churn->next_index.postincrement()];
+
+		for (uint32_t i = 0; i < OBJECT_COUNT; i++) {
+			objects.push_back(memnew(Object));
+			if (i % 3 == 0) {
+				// Free some right away, so slots are reused while others are still alive.
+				Object *object = objects[objects.size() - 1];
+				objects.resize(objects.size() - 1);
+				memdelete(object);
+			}
+		}
+		for (Object *object : objects) {
+			if (ObjectDB::get_instance(object->get_instance_id()) != object) {
+				churn->failures.fetch_add(1);
+			}
+		}
+	}
+
+	static void destroy(void *p_data) {
+		LocalVector<Object *> *objects = (LocalVector<Object *> *)p_data;
+		for (Object *object : *objects) {
+			memdelete(object);
+		}
+	}
+};
+
+TEST_CASE("[Object] Instances created and freed from several threads") {
+	const int initial_count = ObjectDB::get_object_count();
+	ObjectChurn churn;
+
+	Thread threads[ObjectChurn::THREAD_COUNT];
+	for (Thread &thread : threads) {
+		thread.start(ObjectChurn::create, &churn);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK_EQ(churn.failures.load(), 0u);
+
+	HashSet<ObjectID> ids;
+	uint32_t object_count = 0;
+	for (const LocalVector<Object *> &objects : churn.objects) {
+		for (Object *object : objects) {
+			ids.insert(object->get_instance_id());
+			object_count++;
+		}
+	}
+	CHECK_MESSAGE(ids.size() == object_count, "Live instances should have unique IDs.");
+	CHECK_EQ(ObjectDB::get_object_count(), initial_count + int(object_count));
+
+	// Free each batch from a thread other than the one that created it.
+	ObjectID freed_id = churn.objects[0][0]->get_instance_id();
+	for (uint32_t i = 0; i < ObjectChurn::THREAD_COUNT; i++) {
+		threads[i].start(ObjectChurn::destroy, &churn.objects[(i + 1) % ObjectChurn::THREAD_COUNT]);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK(ObjectDB::get_instance(freed_id) == nullptr);
+	CHECK_EQ(ObjectDB::get_object_count(), initial_count);
+}
+
+static void check_debug_object(Object *p_object, void *p_user_data) {
+	// The instance can't be invalidated while the callback runs.
+	if (ObjectDB::get_instance(p_object->get_instance_id()) != p_object) {
+		((std::atomic<uint32_t> *)p_user_data)->fetch_add(1);
+	}
+}
+
+TEST_CASE("[Object] Debug iteration while instances are freed from other threads") {
+	ObjectChurn churn;
+
+	Thread threads[ObjectChurn::THREAD_COUNT];
+	for (Thread &thread : threads) {
+		thread.start(ObjectChurn::create, &churn);
+	}
+	std::atomic<uint32_t> failures = 0;
+	for (int i = 0; i < 100; i++) {
+		ObjectDB::debug_objects(check_debug_object, &failures);
+	}
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK_EQ(failures.load(), 0u);
+	CHECK_EQ(churn.failures.load(), 0u);
+
+	for (LocalVector<Object *> &objects : churn.objects) {
+		ObjectChurn::destroy(&objects);
+	}
+}
+
 } // namespace TestObject
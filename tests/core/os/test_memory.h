@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*  test_memory.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/memory.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMemory {
+
+TEST_CASE("[Memory] Usage is accounted to tags") {
+	const uint64_t usage = Memory::get_mem_usage(Memory::TAG_PHYSICS);
+	const uint64_t general_usage = Memory::get_mem_usage(Memory::TAG_GENERAL);
+
+	void *tagged = Memory::alloc_static(100, false, Memory::TAG_PHYSICS);
+	void *scoped = nullptr;
+	{
+		Memory::TagScope scope(Memory::TAG_PHYSICS);
+		scoped = memalloc(50);
+		{
+			Memory::TagScope inner_scope(Memory::TAG_GENERAL);
+			memfree(memalloc(10));
+		}
+	}
+	void *untagged = memalloc(20);
+
+#ifdef DEBUG_ENABLED
+	CHECK_EQ(Memory::get_mem_usage(Memory::TAG_PHYSICS), usage + 150);
+
+	// Reallocating keeps the tag of the allocation, even outside of the scope it was made in.
+	scoped = memrealloc(scoped, 5000);
+	CHECK_EQ(Memory::get_mem_usage(Memory::TAG_PHYSICS), usage + 5100);
+	CHECK_EQ(Memory::get_mem_usage(Memory::TAG_GENERAL), general_usage + 20);
+#endif
+
+	memfree(tagged);
+	memfree(scoped);
+	memfree(untagged);
+
+	CHECK_EQ(Memory::get_mem_usage(Memory::TAG_PHYSICS), usage);
+	CHECK_EQ(Memory::get_mem_usage(Memory::TAG_GENERAL), general_usage);
+	CHECK_EQ(Memory::current_tag, Memory::TAG_GENERAL);
+}
+
+TEST_CASE("[Memory] Reallocation keeps contents across sizes") {
+	// Crosses the pool size classes and the pooled limit when built with the pooled allocator.
+	uint8_t *data = (uint8_t *)memalloc(1);
+	data[0] = 42;
+	for (size_t size = 2; size <= 16384; size *= 2) {
+		data = (uint8_t *)memrealloc(data, size);
+		data[size - 1] = 42;
+	}
+	for (size_t size = 16384; size >= 2; size /= 2) {
+		data = (uint8_t *)memrealloc(data, size);
+		CHECK_EQ(data[size / 2 - 1], 42);
+	}
+	CHECK_EQ(data[0], 42);
+	memfree(data);
+}
+
+} // namespace TestMemory
@@ -106,6 +106,24 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+TEST_CASE("[WorkerThreadPool] Process a large group task") {
+	const int count = 100000;
+	counter.clear();
+	counter.resize(count);
+
+	const uint64_t processed_before = WorkerThreadPool::get_singleton()->get_processed_task_count();
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_test, nullptr, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool all_run_once = true;
+	for (int i = 0; i < count; i++) {
+		all_run_once &= counter[i].get() == 1;
+	}
+	CHECK(all_run_once);
+	CHECK(WorkerThreadPool::get_singleton()->get_processed_task_count() > processed_before);
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
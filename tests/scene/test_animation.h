@@ -308,4 +308,43 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Animation] Sample compressed tracks") {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Enemy"));
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(rotation_track, NodePath("Enemy"));
+	const int value_track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(value_track, NodePath("Enemy:visible"));
+	for (int i = 0; i <= 20; i++) {
+		double time = i * 0.1;
+		animation->position_track_insert_key(position_track, time, Vector3(i, i * 0.5, -i));
+		animation->rotation_track_insert_key(rotation_track, time, Quaternion(Vector3(0, 1, 0), i * 0.1));
+	}
+	animation->track_insert_key(value_track, 0.0, true);
+	animation->compress();
+
+	CHECK(animation->is_compressed());
+	CHECK(animation->track_is_compressed(position_track));
+	CHECK(animation->track_is_compressed(rotation_track));
+
+	LocalVector<Vector4> values;
+	LocalVector<uint8_t> valid;
+	for (double time : { 0.0, 0.35, 1.0, 1.99, 2.0 }) {
+		animation->sample_compressed_tracks(time, values, valid);
+		REQUIRE(values.size() == 3);
+		CHECK(valid[position_track]);
+		CHECK(valid[rotation_track]);
+		CHECK_FALSE(valid[value_track]);
+
+		Vector3 position;
+		CHECK(animation->try_position_track_interpolate(position_track, time, &position) == OK);
+		CHECK(Vector3(values[position_track].x, values[position_track].y, values[position_track].z).is_equal_approx(position));
+		Quaternion rotation;
+		CHECK(animation->try_rotation_track_interpolate(rotation_track, time, &rotation) == OK);
+		CHECK(Quaternion(values[rotation_track].x, values[rotation_track].y, values[rotation_track].z, values[rotation_track].w).is_equal_approx(rotation));
+	}
+}
+
 } // namespace TestAnimation
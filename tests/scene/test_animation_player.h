@@ -30,7 +30,11 @@
 
 #pragma once
 
+#include "core/config/project_settings.h"
+#include "core/object/message_queue.h"
+#include "scene/3d/node_3d.h"
 #include "scene/animation/animation_player.h"
+#include "scene/main/window.h"
 #include "scene/resources/animation.h"
 #include "tests/test_macros.h"
 
@@ -61,4 +65,83 @@ TEST_CASE("[AnimationPlayer] get & set blend_time") {
 	memdelete(animation_player);
 }
 
+#ifndef _3D_DISABLED
+// Plays the same position and rotation animation on several players, returns the poses after each step.
+static LocalVector<Transform3D> play_mixers(bool p_parallel_blending) {
+	ProjectSettings::get_singleton()->set_setting("animation/mixers/parallel_blending", p_parallel_blending);
+
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(position_track, NodePath("Target"));
+	animation->position_track_insert_key(position_track, 0.0, Vector3(0, 0, 0));
+	animation->position_track_insert_key(position_track, 1.0, Vector3(1, 2, 3));
+	const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+	animation->track_set_path(rotation_track, NodePath("Target"));
+	animation->rotation_track_insert_key(rotation_track, 0.0, Quaternion());
+	animation->rotation_track_insert_key(rotation_track, 1.0, Quaternion(Vector3(0, 1, 0), Math::PI * 0.5));
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("move", animation);
+
+	Node *holder = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(holder);
+
+	LocalVector<AnimationPlayer *> players;
+	LocalVector<Node3D *> targets;
+	for (int i = 0; i < 4; i++) {
+		Node *owner = memnew(Node);
+		holder->add_child(owner);
+		Node3D *target = memnew(Node3D);
+		target->set_name("Target");
+		owner->add_child(target);
+		AnimationPlayer *player = memnew(AnimationPlayer);
+		owner->add_child(player);
+		player->add_animation_library("", library);
+		player->set_speed_scale(1.0 + i * 0.25);
+		player->play("move");
+		players.push_back(player);
+		targets.push_back(target);
+	}
+
+	LocalVector<Transform3D> poses;
+	for (int step = 0; step < 3; step++) {
+		SceneTree::get_singleton()->process(0.1);
+		for (const Node3D *target : targets) {
+			poses.push_back(target->get_transform());
+		}
+	}
+
+	// Seeking a player before the queued blends are flushed must complete its pending blend first.
+	for (AnimationPlayer *player : players) {
+		player->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+	}
+	players[1]->seek(0.8, true);
+	MessageQueue::get_singleton()->flush();
+	for (const Node3D *target : targets) {
+		poses.push_back(target->get_transform());
+	}
+
+	memdelete(holder);
+	ProjectSettings::get_singleton()->set_setting("animation/mixers/parallel_blending", false);
+	return poses;
+}
+
+TEST_CASE("[SceneTree][AnimationPlayer] Parallel blending gives the same poses") {
+	const LocalVector<Transform3D> serial = play_mixers(false);
+	const LocalVector<Transform3D> parallel = play_mixers(true);
+
+	REQUIRE(serial.size() == parallel.size());
+	for (uint32_t i = 0; i < serial.size(); i++) {
+		CHECK_MESSAGE(serial[i] == parallel[i], vformat("Pose %d differs with parallel blending.", i));
+	}
+
+	// The players actually moved their targets.
+	CHECK(serial[0] != Transform3D());
+	CHECK(serial[serial.size() - 3] != serial[serial.size() - 7]);
+}
+#endif // _3D_DISABLED
+
 } // namespace TestAnimationPlayer
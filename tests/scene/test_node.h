@@ -392,6 +392,35 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(child_by_path, node1_1);
 	}
 
+	SUBCASE("Repeated node path lookups should follow changes to the tree") {
+		Node *root = SceneTree::get_singleton()->get_root();
+		node1->set_name("Node1");
+		node2->set_name("Node2");
+		node1_1->set_name("NestedNode");
+
+		const uint64_t hits = Node::path_cache_hits;
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), node1_1);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/NestedNode")), node1_1);
+		CHECK_EQ(Node::path_cache_hits, hits + 1);
+
+		node1_1->set_name("Renamed");
+		CHECK(root->get_node_or_null(NodePath("Node1/NestedNode")) == nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("Node1/Renamed")), node1_1);
+
+		node1->remove_child(node1_1);
+		node2->add_child(node1_1);
+		CHECK(root->get_node_or_null(NodePath("Node1/Renamed")) == nullptr);
+		CHECK_EQ(root->get_node_or_null(NodePath("/root/Node2/Renamed")), node1_1);
+
+		Node *replacement = memnew(Node);
+		replacement->set_name("Renamed");
+		node2->remove_child(node1_1);
+		memdelete(node1_1);
+		node2->add_child(replacement);
+		CHECK_EQ(root->get_node_or_null(NodePath("/root/Node2/Renamed")), replacement);
+		node1_1 = replacement;
+	}
+
 	SUBCASE("Nodes should be accessible via their groups") {
 		Vector<Node *> nodes = SceneTree::get_singleton()->get_nodes_in_group("nodes");
 		CHECK(nodes.is_empty());
@@ -913,4 +942,93 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Automatic process thread groups") {
+	SceneTree *tree = SceneTree::get_singleton();
+	const bool was_enabled = tree->is_auto_process_thread_groups_enabled();
+	tree->set_auto_process_thread_groups(true);
+
+	Node *level = memnew(Node);
+	tree->get_root()->add_child(level);
+
+	// Only instantiated scenes get a group, which is recognized by their scene file path.
+	Node *instance = memnew(Node);
+	instance->set_scene_file_path("res://instance.tscn");
+	Node *instance_child = memnew(Node);
+	instance->add_child(instance_child);
+
+	SUBCASE("Instantiated scenes become sub-thread groups while in the tree") {
+		level->add_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		CHECK_EQ(instance_child->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+
+		level->remove_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+
+		// Entering again makes it a group again.
+		level->add_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+
+		// Disabling the setting doesn't affect nodes already in the tree.
+		tree->set_auto_process_thread_groups(false);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		level->remove_child(instance);
+		level->add_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+	}
+
+	SUBCASE("Plain nodes and nodes inside a thread group are left alone") {
+		Node *plain = memnew(Node);
+		level->add_child(plain);
+		CHECK_EQ(plain->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+
+		plain->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		plain->add_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+	}
+
+	SUBCASE("An explicit process thread group overrides the automatic one") {
+		level->add_child(instance);
+		REQUIRE_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+
+		instance->set_process_thread_group(Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+
+		// The explicit mode is kept after leaving and entering the tree.
+		level->remove_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+		level->add_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_MAIN_THREAD);
+
+		// Explicitly choosing to inherit is respected as well.
+		instance->set_process_thread_group(Node::PROCESS_THREAD_GROUP_INHERIT);
+		level->remove_child(instance);
+		level->add_child(instance);
+		CHECK_EQ(instance->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+	}
+
+	SUBCASE("The current scene and autoloads are excluded") {
+		// Both are direct children of the root.
+		Node *current_scene = memnew(Node);
+		current_scene->set_scene_file_path("res://main.tscn");
+		tree->get_root()->add_child(current_scene);
+		tree->set_current_scene(current_scene);
+		CHECK_EQ(current_scene->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+
+		Node *autoload = memnew(Node);
+		autoload->set_scene_file_path("res://autoload.tscn");
+		tree->get_root()->add_child(autoload);
+		CHECK_EQ(autoload->get_process_thread_group(), Node::PROCESS_THREAD_GROUP_INHERIT);
+
+		tree->set_current_scene(nullptr);
+		memdelete(current_scene);
+		memdelete(autoload);
+	}
+
+	tree->set_auto_process_thread_groups(was_enabled);
+	if (!instance->get_parent()) {
+		memdelete(instance);
+	}
+	memdelete(level);
+}
+
 } // namespace TestNode
@@ -280,4 +280,93 @@ TEST_CASE("[PackedScene] Recreate State") {
 	memdelete(scene);
 }
 
+TEST_CASE("[PackedScene] Repeated Instantiation") {
+	// Create a scene with non-default properties to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	scene->set_process_priority(3);
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_physics_process_priority(-5);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Subsequent instantiations reuse the cached plan and must match the first one.
+	for (int i = 0; i < 3; i++) {
+		Node *instance = packed_scene.instantiate();
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_process_priority() == 3);
+		REQUIRE(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_name() == "Child");
+		CHECK(instance->get_child(0)->get_physics_process_priority() == -5);
+		CHECK(instance->get_child(0)->get_owner() == instance);
+		memdelete(instance);
+	}
+
+	// Packing again must invalidate the cached plan.
+	Node *child2 = memnew(Node);
+	child2->set_name("Child2");
+	scene->add_child(child2);
+	child2->set_owner(scene);
+	scene->set_process_priority(7);
+	packed_scene.pack(scene);
+
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_process_priority() == 7);
+	CHECK(instance->get_child_count() == 2);
+	CHECK(instance->get_child(1)->get_name() == "Child2");
+
+	memdelete(instance);
+	memdelete(scene);
+}
+
+TEST_CASE("[PackedScene] Instance Pool") {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+	CHECK(packed_scene.get_pooled_instance_count() == 0);
+
+	Node *parent = memnew(Node);
+	Node *instance = packed_scene.instantiate_pooled();
+	REQUIRE(instance != nullptr);
+	parent->add_child(instance);
+
+	// Recycling detaches the instance and keeps it for reuse.
+	packed_scene.recycle_instance(instance);
+	CHECK(instance->get_parent() == nullptr);
+	CHECK(parent->get_child_count() == 0);
+	CHECK(packed_scene.get_pooled_instance_count() == 1);
+
+	// Recycling an instance that is already pooled is rejected.
+	ERR_PRINT_OFF;
+	packed_scene.recycle_instance(instance);
+	ERR_PRINT_ON;
+	CHECK(packed_scene.get_pooled_instance_count() == 1);
+
+	Node *reused = packed_scene.instantiate_pooled();
+	CHECK(reused == instance);
+	CHECK(packed_scene.get_pooled_instance_count() == 0);
+
+	// Instances freed while pooled are skipped.
+	packed_scene.recycle_instance(reused);
+	memdelete(reused);
+	Node *fresh = packed_scene.instantiate_pooled();
+	REQUIRE(fresh != nullptr);
+	CHECK(packed_scene.get_pooled_instance_count() == 0);
+
+	packed_scene.recycle_instance(fresh);
+	packed_scene.clear_instance_pool();
+	CHECK(packed_scene.get_pooled_instance_count() == 0);
+
+	memdelete(parent);
+	memdelete(scene);
+}
+
 } // namespace TestPackedScene
@@ -0,0 +1,129 @@
+/**************************************************************************/
+/*  test_raster_occlusion_cull.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "servers/rendering/raster_occlusion_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRasterOcclusionCull {
+
+static bool is_aabb_occluded(RendererSceneOcclusionCull::HZBuffer *p_buffer, const AABB &p_aabb, const Projection &p_projection) {
+	const Vector3 end = p_aabb.get_end();
+	const real_t bounds[6] = { p_aabb.position.x, p_aabb.position.y, p_aabb.position.z, end.x, end.y, end.z };
+	uint64_t occlusion_timeout = 0;
+	return p_buffer->is_occluded(bounds, Vector3(), Transform3D(), p_projection, p_projection.get_z_near(), false, occlusion_timeout);
+}
+
+TEST_CASE("[RasterOcclusionCull] Occluders hide what's behind them") {
+	RasterOcclusionCull occlusion_cull;
+
+	const RID scenario = RID::from_uint64(1);
+	const RID buffer = RID::from_uint64(2);
+	const RID instance = RID::from_uint64(3);
+	occlusion_cull.add_scenario(scenario);
+	occlusion_cull.add_buffer(buffer);
+	occlusion_cull.buffer_set_scenario(buffer, scenario);
+	occlusion_cull.buffer_set_size(buffer, Vector2i(64, 64));
+
+	const RID occluder = occlusion_cull.occluder_allocate();
+	occlusion_cull.occluder_initialize(occluder);
+	const PackedVector3Array quad = { Vector3(-5, -5, 0), Vector3(5, -5, 0), Vector3(5, 5, 0), Vector3(-5, 5, 0) };
+	const PackedInt32Array indices = { 0, 1, 2, 0, 2, 3 };
+	occlusion_cull.occluder_set_mesh(occluder, quad, indices);
+
+	// The camera stays at the origin, looking down -Z.
+	Projection projection;
+	projection.set_perspective(75.0, 1.0, 0.1, 100.0);
+	RendererSceneOcclusionCull::HZBuffer *hz_buffer = occlusion_cull.buffer_get_ptr(buffer);
+	REQUIRE(hz_buffer != nullptr);
+
+	SUBCASE("Quad in front of the camera") {
+		occlusion_cull.scenario_set_instance(scenario, instance, occluder, Transform3D(Basis(), Vector3(0, 0, -10)), true);
+		occlusion_cull.buffer_update(buffer, Transform3D(), projection, false);
+
+		CHECK_MESSAGE(is_aabb_occluded(hz_buffer, AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2)), projection), "Behind the quad.");
+		CHECK_FALSE_MESSAGE(is_aabb_occluded(hz_buffer, AABB(Vector3(12, -1, -21), Vector3(2, 2, 2)), projection), "Beside the quad.");
+		CHECK_FALSE_MESSAGE(is_aabb_occluded(hz_buffer, AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2)), projection), "In front of the quad.");
+
+		// Disabled occluders don't hide anything.
+		occlusion_cull.scenario_set_instance(scenario, instance, occluder, Transform3D(Basis(), Vector3(0, 0, -10)), false);
+		occlusion_cull.buffer_update(buffer, Transform3D(), projection, false);
+		CHECK_FALSE(is_aabb_occluded(hz_buffer, AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2)), projection));
+	}
+
+	SUBCASE("Quad crossing the near plane") {
+		// A floor under the camera, reaching from behind it to far in front of it.
+		const Transform3D floor_xform = Transform3D(Basis(Vector3(1, 0, 0), -Math::PI * 0.5).scaled(Vector3(4, 1, 4)), Vector3(0, -1, -10));
+		occlusion_cull.scenario_set_instance(scenario, instance, occluder, floor_xform, true);
+		occlusion_cull.buffer_update(buffer, Transform3D(), projection, false);
+
+		CHECK_MESSAGE(is_aabb_occluded(hz_buffer, AABB(Vector3(-1, -5, -16), Vector3(2, 2, 2)), projection), "Under the floor.");
+		CHECK_FALSE_MESSAGE(is_aabb_occluded(hz_buffer, AABB(Vector3(-1, 0, -16), Vector3(2, 2, 2)), projection), "Above the floor.");
+	}
+
+	occlusion_cull.remove_buffer(buffer);
+	occlusion_cull.remove_scenario(scenario);
+	occlusion_cull.free_occluder(occluder);
+}
+
+// Stands in for a module backend such as the Embree-based RaycastOcclusionCull.
+class ReplacementOcclusionCull : public RendererSceneOcclusionCull {};
+
+TEST_CASE("[RasterOcclusionCull] Backends registered later replace the raster fallback") {
+	// Same order as the engine: the rendering server creates the raster fallback, modules register afterwards.
+	RendererSceneOcclusionCull *previous = RendererSceneOcclusionCull::get_singleton();
+	RasterOcclusionCull *raster = memnew(RasterOcclusionCull);
+	RendererSceneOcclusionCull *fallback = previous ? previous : raster;
+	CHECK(RendererSceneOcclusionCull::get_singleton() == fallback);
+
+	ReplacementOcclusionCull *replacement = memnew(ReplacementOcclusionCull);
+	CHECK_MESSAGE(RendererSceneOcclusionCull::get_singleton() == fallback, "Creating a backend doesn't replace the singleton by itself.");
+	replacement->replace_singleton();
+	CHECK(RendererSceneOcclusionCull::get_singleton() == replacement);
+
+	SUBCASE("Replacement freed first") {
+		memdelete(replacement);
+		CHECK(RendererSceneOcclusionCull::get_singleton() == fallback);
+		memdelete(raster);
+	}
+
+	SUBCASE("Fallback freed first") {
+		memdelete(raster);
+		CHECK(RendererSceneOcclusionCull::get_singleton() == replacement);
+		memdelete(replacement);
+	}
+
+	CHECK(RendererSceneOcclusionCull::get_singleton() == previous);
+}
+
+} // namespace TestRasterOcclusionCull
@@ -0,0 +1,143 @@
+/**************************************************************************/
+/*  test_renderer_scene_cull.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/rendering/renderer_scene_cull.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererSceneCull {
+
+static void fill_instance_bounds(PagedArray<RendererSceneCull::InstanceBounds> &r_instance_aabbs, uint32_t p_count) {
+	RandomPCG rng(42);
+	for (uint32_t i = 0; i < p_count; i++) {
+		Vector3 position(rng.randf() * 400.0 - 200.0, rng.randf() * 100.0 - 50.0, rng.randf() * 400.0 - 200.0);
+		Vector3 size(rng.randf() * 8.0, rng.randf() * 8.0, rng.randf() * 8.0);
+		r_instance_aabbs.push_back(RendererSceneCull::InstanceBounds(AABB(position, size)));
+	}
+}
+
+static Vector<Vector<Plane>> make_test_frustum_planes() {
+	Projection perspective;
+	perspective.set_perspective(75.0, 16.0 / 9.0, 0.05, 150.0);
+	Projection orthogonal;
+	orthogonal.set_orthogonal(40.0, 1.0, 0.05, 100.0);
+	Transform3D camera_transform = Transform3D(Basis(Vector3(0, 1, 0), 0.6), Vector3(10, 5, 20));
+
+	Vector<Vector<Plane>> planes;
+	planes.push_back(perspective.get_projection_planes(camera_transform));
+	planes.push_back(orthogonal.get_projection_planes(camera_transform));
+	return planes;
+}
+
+TEST_CASE("[RendererSceneCull] Block frustum test matches per-instance test") {
+	// Not a multiple of the block size, so the last block is a partial one.
+	const uint32_t instance_count = 1000;
+
+	PagedArrayPool<RendererSceneCull::InstanceBounds> pool;
+	PagedArray<RendererSceneCull::InstanceBounds> instance_aabbs;
+	instance_aabbs.set_page_pool(&pool);
+	fill_instance_bounds(instance_aabbs, instance_count);
+
+	for (const Vector<Plane> &planes : make_test_frustum_planes()) {
+		const RendererSceneCull::Frustum frustum(planes);
+		RendererSceneCull::InstanceBoundsBlock block;
+		uint32_t mismatches = 0;
+		uint32_t inside = 0;
+		for (uint32_t from = 0; from < instance_count; from += RendererSceneCull::InstanceBoundsBlock::SIZE) {
+			uint32_t count = MIN(instance_count - from, RendererSceneCull::InstanceBoundsBlock::SIZE);
+			block.load(instance_aabbs, from, count);
+			uint64_t mask = block.in_frustum_mask(frustum);
+			for (uint32_t i = 0; i < count; i++) {
+				bool expected = instance_aabbs[from + i].in_frustum(frustum);
+				bool in_block = (mask >> i) & 1;
+				mismatches += expected != in_block;
+				inside += expected;
+			}
+			if (count < RendererSceneCull::InstanceBoundsBlock::SIZE) {
+				// Lanes past the end of a partial block must never be reported.
+				CHECK((mask >> count) == 0);
+			}
+		}
+		CHECK(inside > 0);
+		CHECK(inside < instance_count);
+		CHECK(mismatches == 0);
+	}
+
+	instance_aabbs.reset();
+	pool.reset();
+}
+
+// Run with `--test --no-skip --test-case="*Benchmark*"`.
+TEST_CASE("[RendererSceneCull][Benchmark] Block frustum test" * doctest::skip()) {
+	const uint32_t instance_count = 1'000'000;
+
+	PagedArrayPool<RendererSceneCull::InstanceBounds> pool;
+	PagedArray<RendererSceneCull::InstanceBounds> instance_aabbs;
+	instance_aabbs.set_page_pool(&pool);
+	fill_instance_bounds(instance_aabbs, instance_count);
+
+	const OS *os = OS::get_singleton();
+
+	for (const Vector<Plane> &planes : make_test_frustum_planes()) {
+		const RendererSceneCull::Frustum frustum(planes);
+
+		uint64_t begin = os->get_ticks_usec();
+		uint32_t inside = 0;
+		for (uint32_t i = 0; i < instance_count; i++) {
+			inside += instance_aabbs[i].in_frustum(frustum);
+		}
+		const uint64_t instance_usec = os->get_ticks_usec() - begin;
+
+		begin = os->get_ticks_usec();
+		RendererSceneCull::InstanceBoundsBlock block;
+		uint32_t inside_blocks = 0;
+		for (uint32_t from = 0; from < instance_count; from += RendererSceneCull::InstanceBoundsBlock::SIZE) {
+			uint32_t count = MIN(instance_count - from, RendererSceneCull::InstanceBoundsBlock::SIZE);
+			block.load(instance_aabbs, from, count);
+			uint64_t mask = block.in_frustum_mask(frustum);
+			for (uint32_t i = 0; i < count; i++) {
+				inside_blocks += (mask >> i) & 1;
+			}
+		}
+		const uint64_t block_usec = os->get_ticks_usec() - begin;
+
+		CHECK(inside_blocks == inside);
+		MESSAGE(vformat("%d instances, %d inside. Per instance: %d ms, blocks: %d ms.", instance_count, inside, instance_usec / 1000, block_usec / 1000));
+	}
+
+	instance_aabbs.reset();
+	pool.reset();
+}
+
+} // namespace TestRendererSceneCull
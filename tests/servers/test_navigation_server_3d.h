@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/config/project_settings.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_3d/navigation_server_3d.h"
@@ -698,6 +699,28 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_NE(navigation_server->map_get_path(map, Vector3(0, 0, 0), Vector3(10, 0, 10), false).size(), 0);
 		}
 
+		SUBCASE("Batched path queries should match single path queries") {
+			PackedVector3Array origins;
+			PackedVector3Array destinations;
+			for (int i = 0; i < 64; i++) {
+				origins.push_back(Vector3(i % 8, 0, i / 8));
+				destinations.push_back(Vector3(10 - i % 5, 0, 10 - i % 7));
+			}
+			Array result = navigation_server->map_get_paths(map, origins, destinations, true);
+			REQUIRE_EQ(result.size(), 2);
+			PackedVector3Array points = result[0];
+			PackedInt32Array ends = result[1];
+			REQUIRE_EQ(ends.size(), origins.size());
+			int begin = 0;
+			for (int i = 0; i < origins.size(); i++) {
+				Vector<Vector3> path = navigation_server->map_get_path(map, origins[i], destinations[i], true);
+				CHECK_EQ(ends[i] - begin, path.size());
+				CHECK_EQ(points.slice(begin, ends[i]), path);
+				begin = ends[i];
+			}
+			CHECK_EQ(ends[ends.size() - 1], points.size());
+		}
+
 		SUBCASE("'map_get_closest_point_to_segment' with 'use_collision' should return default if segment doesn't intersect map") {
 			CHECK_EQ(navigation_server->map_get_closest_point_to_segment(map, Vector3(1, 2, 1), Vector3(1, 1, 1), true), Vector3());
 		}
@@ -803,6 +826,180 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should respond to hierarchical path queries properly") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A grid of 32x32 quads, so the map has many polygons and clusters.
+		const int grid_size = 32;
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		PackedVector3Array vertices;
+		for (int z = 0; z <= grid_size; z++) {
+			for (int x = 0; x <= grid_size; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < grid_size; z++) {
+			for (int x = 0; x < grid_size; x++) {
+				const int i = z * (grid_size + 1) + x;
+				navigation_mesh->add_polygon({ i, i + 1, i + grid_size + 2, i + grid_size + 1 });
+			}
+		}
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		const Vector3 start_position = Vector3(0.5, 0, 0.5);
+		const Vector3 target_position = Vector3(31.5, 0, 20.5);
+		Vector<Vector3> path = navigation_server->map_get_path(map, start_position, target_position, true);
+		REQUIRE_GT(path.size(), 0);
+
+		// The regions build their clusters when they are updated, so use a second map and region.
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/hierarchical_cluster_size", 4.0);
+		RID hierarchical_map = navigation_server->map_create();
+		navigation_server->map_set_active(hierarchical_map, true);
+		navigation_server->map_set_use_async_iterations(hierarchical_map, false);
+
+		RID hierarchical_region = navigation_server->region_create();
+		navigation_server->region_set_use_async_iterations(hierarchical_region, false);
+		navigation_server->region_set_map(hierarchical_region, hierarchical_map);
+		navigation_server->region_set_navigation_mesh(hierarchical_region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		SUBCASE("Hierarchical path should connect the same positions with a similar length") {
+			Vector<Vector3> hierarchical_path = navigation_server->map_get_path(hierarchical_map, start_position, target_position, true);
+			REQUIRE_GT(hierarchical_path.size(), 0);
+			CHECK(hierarchical_path[0].is_equal_approx(path[0]));
+			CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(path[path.size() - 1]));
+
+			real_t path_length = 0.0;
+			for (int i = 1; i < path.size(); i++) {
+				path_length += path[i - 1].distance_to(path[i]);
+			}
+			real_t hierarchical_path_length = 0.0;
+			for (int i = 1; i < hierarchical_path.size(); i++) {
+				hierarchical_path_length += hierarchical_path[i - 1].distance_to(hierarchical_path[i]);
+			}
+			CHECK_LE(hierarchical_path_length, path_length * 1.25);
+		}
+
+		SUBCASE("Hierarchical path to an excluded region should stay empty") {
+			Ref<NavigationPathQueryParameters3D> query_parameters;
+			query_parameters.instantiate();
+			query_parameters->set_map(hierarchical_map);
+			query_parameters->set_start_position(start_position);
+			query_parameters->set_target_position(target_position);
+			query_parameters->set_excluded_regions({ hierarchical_region });
+			Ref<NavigationPathQueryResult3D> query_result;
+			query_result.instantiate();
+			navigation_server->query_path(query_parameters, query_result);
+			CHECK_EQ(query_result->get_path().size(), 0);
+		}
+
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/hierarchical_cluster_size", 0.0);
+		navigation_server->free_rid(hierarchical_region);
+		navigation_server->free_rid(hierarchical_map);
+		navigation_server->free_rid(region);
+		navigation_server->free_rid(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Hierarchical path queries should only search the cluster corridor") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A grid of 32x32 quads with a wall between the start and the target, open only at its far end.
+		// The regular search floods the whole area in front of the wall before it goes around.
+		const int grid_size = 32;
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		PackedVector3Array vertices;
+		for (int z = 0; z <= grid_size; z++) {
+			for (int x = 0; x <= grid_size; x++) {
+				vertices.push_back(Vector3(x, 0, z));
+			}
+		}
+		navigation_mesh->set_vertices(vertices);
+		for (int z = 0; z < grid_size; z++) {
+			for (int x = 0; x < grid_size; x++) {
+				if (z == 16 && x < 29) {
+					continue;
+				}
+				const int i = z * (grid_size + 1) + x;
+				navigation_mesh->add_polygon({ i, i + 1, i + grid_size + 2, i + grid_size + 1 });
+			}
+		}
+
+		RID maps[2];
+		RID regions[2];
+		for (int i = 0; i < 2; i++) {
+			// The regions build their clusters when they are updated, only the second one uses them.
+			ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/hierarchical_cluster_size", i == 0 ? 0.0 : 4.0);
+			maps[i] = navigation_server->map_create();
+			navigation_server->map_set_active(maps[i], true);
+			navigation_server->map_set_use_async_iterations(maps[i], false);
+			regions[i] = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(regions[i], false);
+			navigation_server->region_set_map(regions[i], maps[i]);
+			navigation_server->region_set_navigation_mesh(regions[i], navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		}
+		ProjectSettings::get_singleton()->set_setting("navigation/pathfinding/hierarchical_cluster_size", 0.0);
+
+		const Vector3 start_position = Vector3(14.5, 0, 14.5);
+		const Vector3 target_position = Vector3(14.5, 0, 18.5);
+		Ref<NavigationPathQueryParameters3D> query_parameters;
+		query_parameters.instantiate();
+		query_parameters->set_start_position(start_position);
+		query_parameters->set_target_position(target_position);
+		Ref<NavigationPathQueryResult3D> query_result;
+		query_result.instantiate();
+
+		SUBCASE("Only the corridor search should reach the target within the polygon limit") {
+			query_parameters->set_path_search_max_polygons(200);
+
+			query_parameters->set_map(maps[0]);
+			navigation_server->query_path(query_parameters, query_result);
+			Vector<Vector3> path = query_result->get_path();
+			REQUIRE_GT(path.size(), 0);
+			CHECK_FALSE(path[path.size() - 1].is_equal_approx(target_position));
+
+			query_parameters->set_map(maps[1]);
+			navigation_server->query_path(query_parameters, query_result);
+			Vector<Vector3> hierarchical_path = query_result->get_path();
+			REQUIRE_GT(hierarchical_path.size(), 0);
+			CHECK(hierarchical_path[0].is_equal_approx(start_position));
+			CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(target_position));
+		}
+
+		SUBCASE("Reaching the polygon limit inside the corridor should not fall back to the regular search") {
+			query_parameters->set_path_search_max_polygons(100);
+
+			query_parameters->set_map(maps[0]);
+			navigation_server->query_path(query_parameters, query_result);
+			Vector<Vector3> path = query_result->get_path();
+			REQUIRE_GT(path.size(), 0);
+
+			query_parameters->set_map(maps[1]);
+			navigation_server->query_path(query_parameters, query_result);
+			Vector<Vector3> hierarchical_path = query_result->get_path();
+			REQUIRE_GT(hierarchical_path.size(), 0);
+			CHECK_FALSE(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(target_position));
+			CHECK_FALSE(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(path[path.size() - 1]));
+		}
+
+		for (int i = 0; i < 2; i++) {
+			navigation_server->free_rid(regions[i]);
+			navigation_server->free_rid(maps[i]);
+		}
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {